@@ -37,24 +37,32 @@
 
 
 //**********************************************************************************************************
-// FAST IDCT
+// FAST IDCT : IDCT entière en virgule fixe (schéma "islow" de la libjpeg), résultat exact indépendant du compilateur
 
-// Inverse du module papillon de loeffler pour récupérer I0
-float papillon_inv_I0(float O0, float O1);
+// Fast Inverse Discrete Cosine Transform function (entière, en place : coefficients -> échantillons 0..255)
+int8_t fast_IDCT_function(int16_t **input);
 
-// Inverse du module papillon de loeffler pour récupérer I1
-float papillon_inv_I1(float O0, float O1);
+// IDCT d'un bloc dont les coefficients d'indice (zigzag) > last_nonzero sont nuls
+int8_t fast_IDCT_function_sparse(int16_t **input, uint8_t last_nonzero);
 
-// Inverse du module rotation de loeffler pour récupérer I0
-float rotation_inv_I0(float O0, float O1, float k, uint8_t num_coef);
+// Noyaux d'IDCT (choisi à l'exécution selon le processeur, cf. get_IDCT_kernel()) : résultats identiques au bit près
+// >>> IDCT_KERNEL_AVX2 : bloc entier en registres (passe 1, transposition, passe 2, saturation 8 bits)
+enum IDCTKernel {
+    IDCT_KERNEL_SCALAR,
+    IDCT_KERNEL_AVX2
+};
 
-// Inverse du module rotation de loeffler pour récupérer I1
-float rotation_inv_I0(float O0, float O1, float k, uint8_t num_coef);
+enum IDCTKernel get_IDCT_kernel();
+const char * get_IDCT_kernel_name(enum IDCTKernel kernel);
 
-// Fast Inverse Discrete Cosine Transform function using Loeffler algorithm
-int8_t fast_IDCT_function(int16_t **input);
+// Même chose que fast_IDCT_function_sparse() avec un noyau imposé (il doit être disponible sur le processeur)
+int8_t fast_IDCT_function_with_kernel(enum IDCTKernel kernel, int16_t **input, uint8_t last_nonzero);
 
 //**********************************************************************************************************
+// Fonction qui récupère les données de la structure JPEG et qui procède à l'IDCT inverse (meilleur noyau disponible)
 int8_t IDCT(struct JPEG * jpeg);
 
+// Même chose avec un noyau imposé
+int8_t IDCT_with_kernel(struct JPEG * jpeg, enum IDCTKernel kernel);
+
 #endif
@@ -10,11 +10,43 @@
 #include <extract.h>
 #include <utils.h>
 
+struct BlockInfo;   // cf. extract.h (IQ.h peut être inclus avant sa définition, via huffman.h)
+
+
+// Multiplie un coefficient par son pas de quantification, en saturant le résultat sur 16 bits
+// (partagé par IQ_function_sparse() et decode_MCU(), qui déquantifie directement pendant le décodage de Huffman)
+static inline int16_t dequantize_coefficient(int16_t coefficient, uint16_t quantization) {
+    int32_t result = (int32_t)coefficient * quantization;
+    if (result > INT16_MAX) return INT16_MAX;
+    if (result < INT16_MIN) return INT16_MIN;
+    return (int16_t)result;
+}
 
 // Inverse quantization function
 void IQ_function(int16_t *mcu, const uint8_t *qtable);
 
+// Quantification inverse limitée aux coefficients d'indice (zigzag) <= last_nonzero
+void IQ_function_sparse(int16_t *mcu, const uint8_t *qtable, uint8_t last_nonzero);
+
+// Noyaux de quantification inverse d'un plan de blocs (choisi à l'exécution selon le processeur, cf. get_IQ_kernel())
+enum IQKernel {
+    IQ_KERNEL_SCALAR,
+    IQ_KERNEL_SSE2,
+    IQ_KERNEL_AVX2
+};
+
+enum IQKernel get_IQ_kernel();
+const char * get_IQ_kernel_name(enum IQKernel kernel);
+
+// Quantification inverse (en place) de nb_blocks blocs contigus qui partagent la même table (ordre zigzag),
+// par exemple tous ceux d'une composante (cf. get_coefficients()) ; les blocs vides (nb_nonzero == 0) sont sautés
+void IQ_plane(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable);
+
+// Même chose avec un noyau imposé (il doit être disponible sur le processeur, cf. get_IQ_kernel())
+void IQ_plane_with_kernel(enum IQKernel kernel, int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable);
+
 // Fonction qui récupère les données de la structure JPEG et qui procède à la quantification inverse
+// Sans effet si les coefficients ont déjà été déquantifiés par decode_MCU() (cf. get_JPEG_dequantized())
 int8_t IQ(struct JPEG * jpeg);
 
 #endif
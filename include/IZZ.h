@@ -1,3 +1,6 @@
+#ifndef _IZZ_H_
+#define _IZZ_H_
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <stdint.h>
@@ -7,7 +10,31 @@
 #include <utils.h>
 
 
-// Fonction qui permet de dé-zigzaguer un bloc
-int8_t IZZ_function(int16_t **mcu);
+// Fonction qui permet de dé-zigzaguer un bloc (en place)
+void IZZ_function(int16_t *mcu);
+
+// Dé-zigzague un bloc (en place) dont les coefficients d'indice (zigzag) > last_nonzero sont nuls
+void IZZ_function_sparse(int16_t *mcu, uint8_t last_nonzero);
+
+// Noyaux de dé-zigzag d'un plan de blocs (choisi à l'exécution selon le processeur, cf. get_IZZ_kernel())
+// >>> IZZ_KERNEL_SSSE3 : chaque bloc est permuté en registres par des pshufb
+// >>> IZZ_KERNEL_SCALAR : chaque bloc est traité par IZZ_function_sparse()
+enum IZZKernel {
+    IZZ_KERNEL_SCALAR,
+    IZZ_KERNEL_SSSE3
+};
+
+enum IZZKernel get_IZZ_kernel();
+const char * get_IZZ_kernel_name(enum IZZKernel kernel);
+
+// Dé-zigzague (en place) nb_blocks blocs contigus, par exemple tous ceux d'une composante (cf. get_coefficients())
+void IZZ_plane(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks);
+
+// Même chose avec un noyau imposé (il doit être disponible sur le processeur, cf. get_IZZ_kernel())
+void IZZ_plane_with_kernel(enum IZZKernel kernel, int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks);
+
+// Dé-zigzague tous les blocs de l'image
+// Sans effet si decode_MCU() a déjà rangé les coefficients dans l'ordre naturel (cf. get_JPEG_dequantized())
+int8_t IZZ(struct JPEG * jpeg);
 
-int8_t IZZ(struct JPEG * jpeg);
\ No newline at end of file
+#endif
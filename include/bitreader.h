@@ -0,0 +1,95 @@
+#ifndef _BITREADER_H_
+#define _BITREADER_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Nombre minimum de bits disponibles dans le réservoir après un appel à bit_reader_refill()
+#define BIT_READER_MIN_BITS 56
+
+
+//**********************************************************************************************************************
+// Lecteur de bits : réservoir de 64 bits rechargé par mots de 8 octets
+// Les bits en attente sont alignés sur le MSB de buffer
+// Les données sont lues telles qu'elles sont dans le fichier : le byte stuffing (0xFF 0x00) est retiré à la volée
+// et un marker (0xFF suivi d'un autre octet) termine les données
+// Les positions (en bits) sont comptées dans les données du fichier : un octet de stuffing occupe 8 bits de position
+struct BitReader {
+    const unsigned char *start;     // début des données compressées
+    const unsigned char *ptr;       // prochain octet à charger dans le réservoir
+    const unsigned char *end;       // fin des données
+    const unsigned char *last_stuffing; // dernier octet de stuffing sauté (NULL si aucun)
+    uint64_t buffer;                // réservoir de bits
+    uint8_t nb_bits;                // nombre de bits valides dans le réservoir
+    size_t nb_virtual_bytes;        // nombre d'octets nuls "virtuels" chargés après la fin des données
+};
+
+
+// Initialise le lecteur sur size octets de données
+void initialize_bit_reader(struct BitReader *reader, const unsigned char *data, size_t size);
+
+// Position courante du lecteur (en bits depuis le début des données)
+size_t get_bit_reader_position(const struct BitReader *reader);
+
+// Replace le lecteur à la position bit_position (en bits depuis le début des données)
+void bit_reader_seek(struct BitReader *reader, size_t bit_position);
+
+// Indique si le lecteur a consommé plus de bits que les données n'en contiennent
+bool bit_reader_overrun(const struct BitReader *reader);
+
+// Recharge le réservoir octet par octet en retirant le byte stuffing (cf. bit_reader_refill())
+void bit_reader_refill_bytes(struct BitReader *reader);
+
+
+// Recharge le réservoir pour avoir au moins BIT_READER_MIN_BITS bits disponibles
+// Chemin rapide : s'il n'y a aucun 0xFF dans les 8 prochains octets, ils sont chargés d'un coup
+// Sinon (byte stuffing, marker, fin des données), on recharge octet par octet
+static inline void bit_reader_refill(struct BitReader *reader) {
+    if (reader->end - reader->ptr >= 8) {
+        uint64_t word;
+        memcpy(&word, reader->ptr, sizeof(word));
+        uint64_t inverted = ~word;  // un octet 0xFF de word devient un octet nul
+        if (((inverted - 0x0101010101010101ULL) & ~inverted & 0x8080808080808080ULL) == 0) {
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+            word = __builtin_bswap64(word);
+#endif
+            reader->buffer |= word >> reader->nb_bits;
+            reader->ptr += (63 - reader->nb_bits) >> 3;
+            reader->nb_bits |= BIT_READER_MIN_BITS;
+            return;
+        }
+    }
+    bit_reader_refill_bytes(reader);
+}
+
+// Renvoie (sans les consommer) les nb_bits prochains bits (1 <= nb_bits <= BIT_READER_MIN_BITS)
+static inline uint32_t bit_reader_peek(const struct BitReader *reader, uint8_t nb_bits) {
+    return (uint32_t) (reader->buffer >> (64 - nb_bits));
+}
+
+// Consomme nb_bits bits du réservoir
+static inline void bit_reader_consume(struct BitReader *reader, uint8_t nb_bits) {
+    reader->buffer <<= nb_bits;
+    reader->nb_bits -= nb_bits;
+}
+
+// Lit et consomme nb_bits bits (0 <= nb_bits <= 16)
+static inline uint16_t bit_reader_get(struct BitReader *reader, uint8_t nb_bits) {
+    if (nb_bits == 0) return 0;
+    uint16_t value = bit_reader_peek(reader, nb_bits);
+    bit_reader_consume(reader, nb_bits);
+    return value;
+}
+
+// Retrouve la valeur signée d'un coefficient à partir de sa magnitude et de son indice dans la classe de magnitude
+// >>> les indices de la première moitié de la classe codent les valeurs négatives
+static inline int16_t bit_reader_extend(uint16_t indice_dans_classe_magnitude, uint8_t magnitude) {
+    if (magnitude != 0 && indice_dans_classe_magnitude < (1u << (magnitude - 1))) {
+        return (int16_t) (indice_dans_classe_magnitude - (1 << magnitude) + 1);
+    }
+    return (int16_t) indice_dans_classe_magnitude;
+}
+
+#endif
@@ -0,0 +1,73 @@
+#ifndef _DECODE_H_
+#define _DECODE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <extract.h>
+#include <huffman.h>
+#include <speculative.h>
+#include <progressive.h>
+#include <IQ.h>
+#include <IZZ.h>
+#include <IDCT.h>
+#include <stretch.h>
+#include <ycbcr2rgb.h>
+#include <ppm.h>
+#include <utils.h>
+#include <verbose.h>
+
+
+//**********************************************************************************************************************
+// Étapes du décodage après extract() jusqu'au sur-échantillonnage : Huffman (ou scans progressifs), IQ, IZZ, IDCT
+// Les MCUs de la structure JPEG contiennent ensuite les composantes Y, Cb et Cr (0..255) à la taille de l'image
+int8_t decode_JPEG_YCbCr(struct JPEG *jpeg, bool speculative);
+
+// Étapes du décodage après extract() : Huffman (ou scans progressifs), IQ, IZZ, IDCT, sur-échantillonnage et conversion en RGB
+// Les MCUs de la structure JPEG contiennent ensuite les pixels (R, G, B ou la luminance seule en niveaux de gris)
+int8_t decode_JPEG(struct JPEG *jpeg, bool speculative, bool force_grayscale);
+
+// Décodage réduit à 1/8 de la taille de l'image : Huffman (ou scans progressifs), puis un pixel par bloc calculé à partir
+// du seul coefficient DC (ni IQ, ni IZZ, ni IDCT, ni sur-échantillonnage)
+// L'aperçu est passé au callback de la structure JPEG, qui doit être défini (cf. set_JPEG_preview_callback())
+int8_t decode_JPEG_DC_preview(struct JPEG *jpeg, bool speculative);
+
+// Décode l'image JPEG contenue dans les len octets de buf, sans passer par le système de fichiers
+// Les pixels sont écrits dans pixels (pixels_size octets, lignes espacées de stride octets) au format format
+// width et height (s'ils ne sont pas NULL) reçoivent les dimensions de l'image, même si pixels est trop petit
+// Avec pixels == NULL, seules les dimensions sont renvoyées (pour dimensionner le buffer) : rien n'est décodé
+// Renvoie DECODER_OK ou le code de la première erreur rencontrée (cf. verbose.h)
+int8_t jpeg_decode_mem(const uint8_t *buf, size_t len, uint8_t *pixels, size_t pixels_size, size_t stride,
+                       enum PixelFormat format, uint16_t *width, uint16_t *height);
+
+
+//**********************************************************************************************************************
+// Décodeur réutilisable (traitement par lot, serveur) : la structure JPEG de l'image précédente (composantes, blocs de
+// coefficients... cf. extract_mem_into()) et le buffer de pixels sont gardés d'une image à l'autre, et ne grandissent
+// que pour une image plus grande. Une image de même taille, avec des tables déjà lues, se décode sans allocation
+struct JPEGDecoder;
+
+struct JPEGDecoder * create_JPEG_decoder();
+
+// Lit le fichier filename (ou les len octets de buf, qui doivent rester valides) dans la structure du décodeur
+// Renvoie cette structure, à décoder avec decode_JPEG() : elle reste valable jusqu'à l'image suivante
+// Renvoie NULL en cas d'erreur (cf. getDecoderStatus()) : le décodeur reste utilisable
+struct JPEG * JPEG_decoder_extract(struct JPEGDecoder *decoder, char *filename);
+struct JPEG * JPEG_decoder_extract_mem(struct JPEGDecoder *decoder, const uint8_t *buf, size_t len);
+
+// Recopie les pixels de l'image décodée (après decode_JPEG()) dans le buffer du décodeur, au format format, ligne après
+// ligne sans marge. Renvoie le buffer (valable jusqu'à l'image suivante), ou NULL si l'allocation échoue
+const uint8_t * JPEG_decoder_pixels(struct JPEGDecoder *decoder, enum PixelFormat format, bool force_grayscale);
+
+// Comme jpeg_decode_mem(), mais *pixels pointe sur le buffer du décodeur (cf. JPEG_decoder_pixels())
+int8_t JPEG_decoder_decode_mem(struct JPEGDecoder *decoder, const uint8_t *buf, size_t len, enum PixelFormat format,
+                               const uint8_t **pixels, uint16_t *width, uint16_t *height);
+
+// Oublie l'image précédente (fichier, tables) en gardant les allocations
+void reset_JPEG_decoder(struct JPEGDecoder *decoder);
+
+void free_JPEG_decoder(struct JPEGDecoder *decoder);
+
+#endif
@@ -0,0 +1,32 @@
+#ifndef _EXIF_H_
+#define _EXIF_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <extract.h>
+#include <utils.h>
+#include <verbose.h>
+
+#define EXIF_IDENTIFIER_LENGTH 6        // "Exif" suivi de deux 0
+#define TIFF_HEADER_SIZE 8              // ordre des octets (II ou MM), 42, position de l'IFD0
+#define TIFF_MAGIC_NUMBER 42
+#define IFD_ENTRY_SIZE 12               // tag, type, nombre de valeurs, valeur (ou position de la valeur)
+#define IFD_TYPE_SHORT 3
+
+#define EXIF_TAG_THUMBNAIL_OFFSET 0x0201    // JPEGInterchangeFormat : position de la vignette (depuis l'en-tête TIFF)
+#define EXIF_TAG_THUMBNAIL_LENGTH 0x0202    // JPEGInterchangeFormatLength : taille de la vignette en octets
+
+
+//**********************************************************************************************************************
+// Vignette JPEG d'un fichier Exif (appareils photo) : segment APP1 "Exif", en-tête TIFF, IFD0 puis IFD1 qui donne
+// la position et la taille de la vignette (tags 0x0201 et 0x0202)
+// Seuls les segments qui précèdent la première image (SOF, SOS) sont parcourus : les données compressées ne sont pas lues
+// Renvoie true et fait pointer *thumbnail (*thumbnail_size octets, de SOI à EOI) dans data si une vignette JPEG existe
+// Renvoie false sinon (pas de segment Exif, pas d'IFD1, vignette non compressée, positions hors du segment...)
+bool find_exif_thumbnail(const unsigned char *data, size_t size, const unsigned char **thumbnail, size_t *thumbnail_size);
+
+#endif
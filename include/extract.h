@@ -9,12 +9,19 @@
 
 #include <utils.h>
 #include <verbose.h>
+#include <bitreader.h>
+#include <stream.h>
+#include <standard_tables.h>
+#include <table_cache.h>
 
 #define FOUR_BYTES_LONG 4
 
 #define SEGMENT_START 0xff  // Segment start marker
 #define SOI     0xd8        // Start of Image
 #define APP0    0xe0        // Application segment 0
+#define APP1    0xe1        // Application segment 1 (Exif)
+#define APP15   0xef        // Application segment 15
+#define COM     0xfe        // Comment
 #define SOF_0   0xc0        // Baseline DCT
 #define SOF_1   0xc1        // Extended sequential DCT
 #define SOF_2   0xc2        // Progressive DCT
@@ -23,24 +30,26 @@
 #define DQT     0xdb        // Define Quantization Table(s)
 #define SOS     0xda        // Start of Scan
 #define EOI     0xd9        // End of Image
+#define DRI     0xdd        // Define Restart Interval
+#define RST_0   0xd0        // Restart marker 0
+#define RST_7   0xd7        // Restart marker 7
 
 #define LUMINANCE_ID 0x00
 #define CHROMINANCE_ID 0x01
 
 #define INITIAL_DATA_SIZE 1024
+#define INITIAL_RESTART_OFFSETS_SIZE 64
+#define INITIAL_NB_OF_SCANS 16
+
+// Alignement (en octets) des coefficients de chaque composante : une ligne de cache, permet les chargements SIMD alignés
+#define COEFFICIENTS_ALIGNMENT 64
 
 #define MAX_NUMBER_OF_HUFFMAN_TABLES 4
 #define MAX_NUMBER_OF_QUANTIZATION_TABLES 3
+#define MAX_NUMBER_OF_COMPONENTS 3   // niveaux de gris (1) ou YCbCr (3)
 
 struct JPEG;
 
-//**********************************************************************************************************************
-// Structure représentant un noeud de l'arbre de huffman
-struct node;
-
-// Crée un nouveau noeud de l'arbre de Huffman
-struct node * create_node(int8_t symbol, struct node *left, struct node *right);
-
 #include <huffman.h>
 //**********************************************************************************************************************
 struct QuantizationTable;
@@ -48,6 +57,8 @@ int8_t initialize_qt(struct QuantizationTable *qt, int8_t id, size_t length, uns
 int8_t get_qt_id(struct QuantizationTable *qt);
 size_t get_qt_length(struct QuantizationTable *qt);
 uint8_t * get_qt_data(struct QuantizationTable *qt);
+const uint16_t * get_qt_dequantization(struct QuantizationTable *qt);
+bool get_qt_set(struct QuantizationTable *qt);
 
 //**********************************************************************************************************************
 struct ComponentSOF;
@@ -65,20 +76,34 @@ struct ComponentSOF * get_sof_component(struct ComponentSOF * components, int8_t
 
 //**********************************************************************************************************************
 struct HuffmanTable;
-void initialize_ht(struct HuffmanTable *ht, int8_t class, int8_t destination, size_t length, unsigned char *data, struct node * huffman_tree, bool set);
+void initialize_ht(struct HuffmanTable *ht, int8_t class, int8_t destination, size_t length, unsigned char *data, bool set);
 int8_t get_ht_class(struct HuffmanTable *ht);
 int8_t get_ht_destination(struct HuffmanTable *ht);
 size_t get_ht_length(struct HuffmanTable *ht);
 unsigned char * get_ht_data(struct HuffmanTable *ht);
-struct node * get_ht_tree(struct HuffmanTable *ht);
+struct HuffmanCanonical * get_ht_canonical(struct HuffmanTable *ht);
+struct HuffmanLookup * get_ht_lookup(struct HuffmanTable *ht);
+struct ACFastLookup * get_ht_AC_fast_lookup(struct HuffmanTable *ht);
 bool get_ht_set(struct HuffmanTable *ht);
 
 //**********************************************************************************************************************
+// Informations sur les coefficients d'un bloc 8x8, remplies lors du décodage de Huffman
+// >>> nb_nonzero   : nombre de coefficients non nuls
+// >>> last_nonzero : indice (dans l'ordre zigzag) du dernier coefficient non nul (0 pour un bloc qui ne contient que le DC)
+struct BlockInfo {
+    uint8_t nb_nonzero;
+    uint8_t last_nonzero;
+};
+
 struct ComponentSOS;
 int8_t initialize_component_sos(struct ComponentSOS *component, int8_t id_table, int8_t DC_huffman_table_id, int8_t AC_huffman_table_id, size_t nb_of_MCUs);
+void free_component_blocks(struct ComponentSOS *component);
 int8_t get_DC_huffman_table_id(struct ComponentSOS *component);
 int8_t get_AC_huffman_table_id(struct ComponentSOS *component);
+int8_t get_id_table(struct ComponentSOS *component);
 int16_t **get_MCUs(struct ComponentSOS *component);
+struct BlockInfo *get_blocks_info(struct ComponentSOS *component);
+int16_t *get_coefficients(struct ComponentSOS *component);     // blocs contigus : MCUs[j] == coefficients + 64 * j
 void set_value_in_MCU(struct ComponentSOS *component, int index_of_mcu, int index_of_pixel_in_mcu, int16_t value);
 
 struct StartOfScan;
@@ -87,10 +112,42 @@ int8_t get_sos_nb_components(struct StartOfScan *sos);
 struct ComponentSOS * get_sos_components(struct StartOfScan *sos);
 struct ComponentSOS * get_sos_component(struct ComponentSOS * components, int8_t index);
 
+//**********************************************************************************************************************
+// Scan d'une image progressive (SOF2) : chaque scan n'apporte qu'une partie des coefficients
+// >>> spectral_start..spectral_end : coefficients (ordre zigzag) du scan, 0..0 pour un scan DC
+// >>> approximation_high : bit de poids faible du scan précédent sur cette bande (0 pour un premier passage)
+// >>> approximation_low  : les coefficients du scan sont décalés de approximation_low bits
+// Les données compressées restent dans le fichier, les markers RSTn sont repérés comme pour un scan séquentiel
+struct ProgressiveScan {
+    int8_t nb_components;
+    int8_t component_indices[3];            // indices des composantes dans le Start Of Frame
+    struct HuffmanTable *DC_tables[3];      // tables en vigueur lors du scan (une DHT suivante peut les redéfinir)
+    struct HuffmanTable *AC_tables[3];
+    uint8_t spectral_start;
+    uint8_t spectral_end;
+    uint8_t approximation_high;
+    uint8_t approximation_low;
+    uint16_t restart_interval;
+    const unsigned char *data;
+    size_t size;                            // en octets
+    size_t *restart_offsets;                // position (en octets dans data) de chaque marker RSTn
+    size_t nb_restart_offsets;
+    size_t restart_offsets_size;
+};
+
+// Aperçu d'une image progressive : function est appelée avec une image réduite (1/8) dès que tous les coefficients DC
+// ont été lus, bien avant la fin du décodage (cf. decode_progressive())
+// >>> pixels : width * height pixels, nb_components octets par pixel (luminance, ou R G B)
+struct PreviewCallback {
+    void (*function)(const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components, void *user_data);
+    void *user_data;    // passé tel quel à function
+};
+
 //**********************************************************************************************************************
 
 int8_t initialize_JPEG_struct(struct JPEG *jpeg);
 void free_JPEG_struct(struct JPEG *jpeg);
+void reset_JPEG_struct(struct JPEG *jpeg, bool keep_tables);
 int16_t get_JPEG_height(struct JPEG *jpeg);
 int16_t get_JPEG_width(struct JPEG *jpeg);
 size_t get_JPEG_nb_Mcu_Width(struct JPEG *jpeg);
@@ -103,24 +160,74 @@ struct QuantizationTable ** get_JPEG_qt(struct JPEG *jpeg);
 struct StartOfFrame ** get_JPEG_sof(struct JPEG *jpeg);
 struct HuffmanTable * get_JPEG_ht(struct JPEG *jpeg, int8_t index);
 struct StartOfScan ** get_JPEG_sos(struct JPEG *jpeg);
-unsigned char * get_JPEG_image_data(struct JPEG* jpeg);
+const unsigned char * get_JPEG_image_data(struct JPEG* jpeg);
 unsigned long long get_JPEG_image_data_size_in_bits(struct JPEG* jpeg);
+uint16_t get_JPEG_restart_interval(struct JPEG* jpeg);
+size_t * get_JPEG_restart_offsets(struct JPEG* jpeg);
+size_t get_JPEG_nb_restart_offsets(struct JPEG* jpeg);
+bool get_JPEG_header_only(struct JPEG* jpeg);
+bool get_JPEG_progressive(struct JPEG* jpeg);
+bool get_JPEG_dequantized(struct JPEG* jpeg);
+void set_JPEG_dequantized(struct JPEG* jpeg, bool dequantized);
+struct ProgressiveScan * get_JPEG_scans(struct JPEG* jpeg);
+size_t get_JPEG_nb_scans(struct JPEG* jpeg);
+struct PreviewCallback get_JPEG_preview_callback(struct JPEG* jpeg);
+void set_JPEG_preview_callback(struct JPEG* jpeg, struct PreviewCallback callback);
+struct DecoderContext * get_JPEG_context(struct JPEG* jpeg);
 
 //**********************************************************************************************************************
-int8_t ignore_bytes(FILE *input, int nb_bytes);
-
 int8_t is_valid_sampling_factors(uint8_t sampling_factor_x, uint8_t sampling_factor_y);
 
 int8_t divide_Y_sampling_factor(uint8_t chrominance_sampling_factor, uint8_t luminance_sampling_factor);
 
-struct QuantizationTable * get_qt(FILE *input, unsigned char *buffer);
+struct QuantizationTable * get_qt(struct ByteStream *input, unsigned char *buffer, struct QuantizationTable **quantization_tables, size_t segment_length);
 
-int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg);
+int8_t get_DQT(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg);
 
-struct HuffmanTable * get_DHT(FILE *input, unsigned char *buffer);
+int8_t get_SOF(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg);
 
-int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg);
+struct HuffmanTable * get_huffman_table(struct ByteStream *input, unsigned char *buffer, struct HuffmanTable **huffman_tables, size_t segment_length);
 
+int8_t get_DHT(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg);
+
+int8_t get_DRI(struct ByteStream *input, struct JPEG *jpeg);
+
+int8_t get_SOS(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg);
+
+int8_t get_progressive_SOS(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg);
+
+int8_t find_scan_end(struct JPEG *jpeg, struct ByteStream *input);
+
+int8_t find_progressive_scan_end(struct JPEG *jpeg, struct ByteStream *input);
+
+// Renvoie NULL en cas d'erreur : la cause est enregistrée dans le contexte du décodeur (cf. getDecoderStatus())
 struct JPEG * extract(char *filename);
 
+// Comme extract() mais l'image est lue dans les size octets de data, qui doivent rester valides (et inchangés)
+// jusqu'à free_JPEG_struct() : les données compressées ne sont pas recopiées
+struct JPEG * extract_mem(const unsigned char *data, size_t size);
+
+// Lecture de l'en-tête seul (dimensions, composantes, tables...) : on s'arrête au premier SOS
+// Le reste du fichier n'est jamais lu et les MCUs ne sont pas alloués : la structure ne peut pas être décodée
+struct JPEG * extract_header(char *filename);
+struct JPEG * extract_header_mem(const unsigned char *data, size_t size);
+
+// Image d'un flux Motion-JPEG (images SOI...EOI concaténées) qui commence au début des size octets de data
+// >>> seul le marker SOI est exigé : ni en-tête JFIF, ni DHT (les tables standard s'appliquent, cf. standard_tables.h)
+// >>> previous_frame (ou NULL) : image précédente du flux, déjà décodée ; la nouvelle image reprend ses tables de
+//     quantification, et ses tables de Huffman ne servent qu'à ne pas reconstruire une table redéfinie à l'identique :
+//     une table qu'aucune DHT de la nouvelle image ne définit est la table standard
+// *frame_size reçoit la taille de l'image, marker EOI compris : l'image suivante commence à data + *frame_size
+struct JPEG * extract_frame(const unsigned char *data, size_t size, struct JPEG *previous_frame, size_t *frame_size);
+
+// Comme extract(), extract_mem() et extract_frame(), mais l'image est lue dans jpeg, la structure d'une image
+// précédente (ou NULL : nouvelle structure), qui est renvoyée
+// Ses allocations (composantes, blocs de coefficients, positions des markers RSTn, scans) sont réutilisées et ne
+// grandissent que pour une image plus grande : une image de même taille, avec des tables déjà lues par le processus
+// (cf. table_cache.h), ne fait aucune allocation. En cas d'erreur, jpeg est libérée et NULL est renvoyé
+// >>> extract_frame_into() : les tables de l'image précédente du flux restent en place dans jpeg
+struct JPEG * extract_into(struct JPEG *jpeg, char *filename);
+struct JPEG * extract_mem_into(struct JPEG *jpeg, const unsigned char *data, size_t size);
+struct JPEG * extract_frame_into(struct JPEG *jpeg, const unsigned char *data, size_t size, size_t *frame_size);
+
 #endif
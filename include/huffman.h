@@ -6,38 +6,59 @@
 #include <stdlib.h>
 #include <utils.h>
 #include <verbose.h>
+#include <bitreader.h>
+#include <huffman_tables.h>
 #include <extract.h>
+#include <IQ.h>
 
 #define DC_VALUE_INDEX 0
 
+struct HuffmanTable;
 
 //**********************************************************************************************************************
-// Construit l'arbre de huffman à partir de la table de huffman
-struct node * build_huffman_tree(unsigned char *ht_data);
-
-// Fonction qui free l'arbre de Huffman
-void free_huffman_tree(struct node *root);
-
 // Affiche la représentation binaire d'un entier
 void print_binary(uint16_t value, int16_t length);
 
 // Affiche la représentation binaire d'un code de huffman
 void print_huffman_codes(int *bit_lengths, int8_t *symbols, int n);
 
+//**********************************************************************************************************************
+// Décode le prochain symbole de Huffman à partir du lecteur de bits
+// Renvoie le symbole (et consomme le code) ou -1 si le code est invalide
+int16_t decode_huffman_symbol(struct HuffmanTable *ht, struct BitReader *reader);
+
 //**********************************************************************************************************************
 // Renvoie la valeur du coefficient DC à partir de sa magnitude et de son indice dans la classe de magnitude
-int16_t recover_DC_coeff_value(int8_t magnitude, int16_t indice_dans_classe_magnitude, struct JPEG *jpeg);
+int16_t recover_DC_coeff_value(int8_t magnitude, uint16_t indice_dans_classe_magnitude);
 
 // Renvoie la valeur du coefficient AC à partir de sa magnitude et de son indice dans la classe de magnitude
-int16_t recover_AC_coeff_value(int8_t magnitude, int16_t indice_dans_classe_magnitude, struct JPEG *jpeg);
+int16_t recover_AC_coeff_value(int8_t magnitude, uint16_t indice_dans_classe_magnitude);
 
 //**********************************************************************************************************************
 // Décode un MCU
 // utilise les tables de Huffman de la composante
 // puis récupère les valeurs à encoder via RLE et encodage via magnitude
-int8_t decode_MCU(struct JPEG *jpeg, size_t MCU_number, int8_t component_index, int16_t* previous_DC_value, size_t *current_pos);
+// Chaque coefficient non nul est écrit déjà déquantifié, directement à sa place dans l'ordre naturel (IQ et IZZ inutiles)
+// Si dequantize_DC vaut false, le coefficient DC est laissé tel quel : il sera corrigé puis déquantifié plus tard (cf. speculative.c)
+int8_t decode_MCU(struct JPEG *jpeg, size_t MCU_number, int8_t component_index, int16_t* previous_DC_value, struct BitReader *reader, bool dequantize_DC);
+
+// Parcourt un bloc sans l'enregistrer (mêmes vérifications que decode_MCU(), sans message d'erreur)
+int8_t skip_block(struct HuffmanTable *DC_table, struct HuffmanTable *AC_table, struct BitReader *reader);
+
+// Nombre total de MCUs (au sens "groupe de blocs de toutes les composantes") de l'image
+size_t get_nb_MCUs(struct JPEG *jpeg);
+
+// Décode les MCUs d'indice first_MCU à last_MCU (exclu), dans l'ordre du bitstream, à partir du lecteur de bits
+// previous_DC_values contient les prédicteurs DC de chaque composante (mis à jour au fil du décodage)
+// dequantize_DC : cf. decode_MCU()
+int8_t decode_MCUs_range(struct JPEG *jpeg, size_t first_MCU, size_t last_MCU, struct BitReader *reader, int16_t *previous_DC_values, bool dequantize_DC);
+
+// Décode l'intervalle de restart d'indice interval_index (données comprises entre deux markers RSTn)
+int8_t decode_restart_interval(struct JPEG *jpeg, size_t interval_index);
 
 // Décode le bitstream et récupère les MCU de chacune des composantes
+// Si l'image possède des intervalles de restart (DRI), ils sont répartis entre plusieurs threads
+// Les coefficients sont déquantifiés et dans l'ordre naturel à la sortie (cf. set_JPEG_dequantized())
 int8_t decode_bitstream(struct JPEG * jpeg);
 
 #endif
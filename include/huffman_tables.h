@@ -0,0 +1,70 @@
+#ifndef _HUFFMAN_TABLES_H_
+#define _HUFFMAN_TABLES_H_
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdlib.h>
+#include <verbose.h>
+#include <bitreader.h>
+
+
+//**********************************************************************************************************************
+// Tables de décodage construites à partir du contenu d'un segment DHT
+// Sans dépendance vers la structure JPEG : les tables standard sont aussi construites à la compilation (cf. tools/)
+
+// Longueur maximale d'un code de Huffman et nombre maximal de symboles dans une DHT
+#define MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK 16
+#define MAX_HUFFMAN_SYMBOLS 256
+
+// Nombre de bits lus d'un coup pour décoder un symbole via la table de lookahead
+// (les codes plus longs passent par les tableaux canoniques)
+#define HUFFMAN_LOOKAHEAD_BITS 9
+#define HUFFMAN_LOOKAHEAD_SIZE (1 << HUFFMAN_LOOKAHEAD_BITS)
+
+
+//**********************************************************************************************************************
+// Table de décodage rapide construite à partir d'une DHT
+// Pour chaque valeur possible des HUFFMAN_LOOKAHEAD_BITS prochains bits du bitstream :
+// >>> length : longueur du code de Huffman qui commence ces bits (0 si le code est plus long que la table)
+// >>> symbol : symbole associé à ce code
+struct HuffmanLookup {
+    uint8_t length[HUFFMAN_LOOKAHEAD_SIZE];
+    uint8_t symbol[HUFFMAN_LOOKAHEAD_SIZE];
+};
+
+// Représentation canonique d'une table de Huffman (cf. norme JPEG, annexe F.2.2.3)
+// >>> maxcode[l]   : plus grand code de longueur l (-1 si aucun code n'a cette longueur)
+// >>> valoffset[l] : décalage tel que le symbole du code 'code' de longueur l soit huffval[valoffset[l] + code]
+// >>> huffval      : symboles dans l'ordre de la DHT
+struct HuffmanCanonical {
+    int32_t maxcode[MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK + 1];
+    int32_t valoffset[MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK + 1];
+    uint8_t huffval[MAX_HUFFMAN_SYMBOLS];
+};
+
+// Nombre de bits lus d'un coup par la table combinée des coefficients AC
+#define AC_FAST_BITS 10
+#define AC_FAST_SIZE (1 << AC_FAST_BITS)
+
+// Table combinée pour les coefficients AC : code de Huffman + bits de magnitude en un seul accès
+// >>> value  : valeur signée du coefficient AC
+// >>> run    : nombre de coefficients nuls qui le précèdent
+// >>> length : nombre total de bits (code + magnitude) à consommer (0 si l'entrée doit passer par le décodage classique)
+struct ACFastEntry {
+    int16_t value;
+    uint8_t run;
+    uint8_t length;
+};
+
+struct ACFastLookup {
+    struct ACFastEntry entries[AC_FAST_SIZE];
+};
+
+
+// Construit la représentation canonique (et la table de lookahead associée) à partir de la table de huffman
+int8_t build_huffman_table(unsigned char *ht_data, size_t ht_length, struct HuffmanCanonical *canonical, struct HuffmanLookup *lookup);
+
+// Construit la table combinée Run/Size + magnitude d'une table de Huffman AC
+void build_AC_fast_lookup(unsigned char *ht_data, struct ACFastLookup *AC_fast);
+
+#endif
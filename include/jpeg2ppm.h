@@ -1,10 +1,15 @@
 #ifndef _JPEG2PPM_H_
 #define _JPEG2PPM_H_
 
+#include <decode.h>
+#include <exif.h>
 #include <extract.h>
 #include <huffman.h>
 #include <IDCT.h>
+#include <mjpeg.h>
 #include <ppm.h>
+#include <probe.h>
+#include <speculative.h>
 #include <IQ.h>
 #include <IZZ.h>
 #include <stretch.h>
@@ -0,0 +1,37 @@
+#ifndef _MJPEG_H_
+#define _MJPEG_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <extract.h>
+#include <decode.h>
+#include <ppm.h>
+#include <stream.h>
+#include <utils.h>
+#include <verbose.h>
+
+// Fréquence annoncée dans l'en-tête Y4M (un flux Motion-JPEG ne la précise pas)
+#define Y4M_FRAME_RATE "25:1"
+
+
+//**********************************************************************************************************************
+// Format des images écrites par decode_mjpeg()
+enum FrameOutputFormat {
+    FRAME_OUTPUT_RAW,   // pixels bruts, image après image : R G B (ou la luminance seule en niveaux de gris)
+    FRAME_OUTPUT_Y4M    // flux YUV4MPEG2 : plans Y, Cb, Cr en 4:4:4 (ou Y seul, mono), lisible par ffmpeg, mpv...
+};
+
+// Décode le flux Motion-JPEG filename (images SOI...EOI concaténées, éventuellement séparées par des octets de bourrage)
+// et écrit les images les unes après les autres dans output, au format format
+// Les tables de Huffman et de quantification sont reprises d'une image à l'autre tant qu'elles ne changent pas ;
+// une image sans DHT utilise les tables standard
+// Le nombre d'images décodées et le débit soutenu (images/s) sont affichés sur stderr
+// Renvoie DECODER_OK ou le code de la première erreur rencontrée (le décodage s'arrête à la première image invalide)
+int8_t decode_mjpeg(const char *filename, FILE *output, enum FrameOutputFormat format, bool speculative, bool force_grayscale);
+
+#endif
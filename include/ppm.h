@@ -11,8 +11,39 @@
 #include <utils.h>
 
 
-char* generate_output_filename(const char *input_filename, uint8_t nb_components);
+//**********************************************************************************************************************
+// Format des pixels écrits dans le buffer de l'appelant (octets dans l'ordre de la mémoire)
+// Les images en niveaux de gris sont recopiées sur R, G et B ; le canal alpha vaut toujours 255
+enum PixelFormat {
+    PIXEL_FORMAT_GRAY8,     // 1 octet par pixel : luminance
+    PIXEL_FORMAT_RGB24,     // 3 octets par pixel : R G B
+    PIXEL_FORMAT_BGR24,     // 3 octets par pixel : B G R
+    PIXEL_FORMAT_RGBA32,    // 4 octets par pixel : R G B A
+    PIXEL_FORMAT_BGRA32     // 4 octets par pixel : B G R A
+};
+
+// Nombre d'octets d'un pixel au format format (0 si le format est inconnu)
+uint8_t get_pixel_format_size(enum PixelFormat format);
+
+// Recopie les pixels décodés (après YCbCr2RGB()) dans pixels, ligne par ligne, au format format
+// >>> stride : nombre d'octets entre le début de deux lignes consécutives (>= largeur * taille d'un pixel)
+// >>> force_grayscale : doit être la valeur passée à YCbCr2RGB() (PIXEL_FORMAT_GRAY8 sur une image couleur le demande)
+void write_pixels(struct JPEG *jpeg, uint8_t *pixels, size_t stride, enum PixelFormat format, bool force_grayscale);
+
+// Recopie la composante component (Y, Cb ou Cr : avant YCbCr2RGB(), après le sur-échantillonnage) dans plane,
+// ligne par ligne, un octet par pixel (stride : nombre d'octets entre le début de deux lignes consécutives)
+void write_component_plane(struct JPEG *jpeg, int8_t component, uint8_t *plane, size_t stride);
+
+//**********************************************************************************************************************
+// Nom du fichier de sortie : même dossier et même nom que input_filename, suivi de suffix, extension .pgm ou .ppm
+char* generate_output_filename(const char *input_filename, const char *suffix, uint8_t nb_components);
+
+// Écrit width * height pixels (nb_components octets par pixel : luminance, ou R G B) dans un fichier PGM ou PPM
+int8_t write_pnm(const char *output_filename, const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components);
 
 int8_t write_ppm(const char *input_filename, struct JPEG *jpeg, bool force_grayscale);
 
+// Comme write_ppm(), mais le nom du fichier de sortie est suivi de suffix (cf. generate_output_filename())
+int8_t write_ppm_with_suffix(const char *input_filename, const char *suffix, struct JPEG *jpeg, bool force_grayscale);
+
 #endif
@@ -0,0 +1,22 @@
+#ifndef _PROBE_H_
+#define _PROBE_H_
+
+#include <stdbool.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <extract.h>
+#include <utils.h>
+#include <verbose.h>
+
+
+//**********************************************************************************************************************
+// Mode --probe : description de l'en-tête (cf. extract_header()) sur une ligne JSON, sans décoder l'image
+// {"file", "width", "height", "nb_components", "sampling_factor_x", "sampling_factor_y", "restart_interval",
+//  "components" : [{"id", "sampling_factor_x", "sampling_factor_y", "quantization_table"}...],
+//  "quantization_tables" : [ids...], "huffman_tables" : [{"class", "destination", "nb_symbols"}...],
+//  "scan" : [{"id", "DC_huffman_table", "AC_huffman_table"}...]}
+int8_t write_header_json(FILE *output, const char *filename, struct JPEG *jpeg);
+
+#endif
@@ -0,0 +1,34 @@
+#ifndef _PROGRESSIVE_H_
+#define _PROGRESSIVE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <extract.h>
+#include <huffman.h>
+#include <bitreader.h>
+#include <ycbcr2rgb.h>
+#include <utils.h>
+#include <verbose.h>
+
+
+//**********************************************************************************************************************
+// Décodage d'une image progressive (SOF2)
+// Les scans sont décodés dans l'ordre du fichier et complètent les coefficients (ordre zigzag) de chaque composante :
+// >>> premier passage DC  : différence DC (comme en mode séquentiel) décalée de approximation_low bits
+// >>> raffinement DC      : un bit de plus pour chaque coefficient DC
+// >>> premier passage AC  : coefficients spectral_start..spectral_end d'une composante, avec des plages de blocs vides (EOBRUN)
+// >>> raffinement AC      : un bit de plus pour les coefficients déjà non nuls, et les nouveaux coefficients de valeur +-1
+// À la fin, les coefficients sont encore dans l'ordre zigzag et non déquantifiés : IQ et IZZ s'appliquent avant l'IDCT
+// (contrairement à decode_bitstream(), dont decode_MCU() les déquantifie et les range directement dans l'ordre naturel)
+// Si un aperçu est demandé (cf. set_JPEG_preview_callback()), il est calculé dès que le DC de chaque composante est connu
+int8_t decode_progressive(struct JPEG *jpeg);
+
+// Aperçu à 1/8 de la taille de l'image calculé à partir des seuls coefficients DC (déquantifiés ou non), passé au callback de la
+// structure JPEG (cf. set_JPEG_preview_callback()) : sert aussi aux images séquentielles, après decode_bitstream()
+int8_t emit_DC_preview(struct JPEG *jpeg);
+
+#endif
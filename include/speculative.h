@@ -0,0 +1,36 @@
+#ifndef _SPECULATIVE_H_
+#define _SPECULATIVE_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include <extract.h>
+#include <huffman.h>
+#include <bitreader.h>
+#include <utils.h>
+#include <verbose.h>
+
+// Taille minimale (en octets) d'un morceau de bitstream confié à un thread
+#define SPECULATIVE_MIN_CHUNK_SIZE 16384
+#define SPECULATIVE_MAX_NB_OF_CHUNKS 64
+
+
+//**********************************************************************************************************************
+// Décodage de Huffman parallèle spéculatif (images sans intervalles de restart)
+// (1) le bitstream est découpé en morceaux, chaque thread parcourt le sien à partir d'une position arbitraire
+//     et note la position de début de chaque MCU qu'il croit trouver
+// (2) chaque thread prolonge son parcours dans le morceau suivant jusqu'à retomber sur une position notée par
+//     son voisin : les codes de Huffman se resynchronisent d'eux-mêmes, à partir de là les deux parcours coïncident
+// (3) on recolle les morceaux (position de départ et indice du premier MCU de chacun) puis on les décode en parallèle
+// (4) les prédicteurs DC de chaque morceau partent de 0 : on corrige les coefficients DC par somme préfixe
+// En cas d'incohérence (données invalides, pas de resynchronisation...), on revient au décodage séquentiel
+int8_t decode_bitstream_speculative(struct JPEG *jpeg);
+
+// Même décodage, en nb_chunks morceaux (au plus SPECULATIVE_MAX_NB_OF_CHUNKS) quels que soient le nombre de coeurs et
+// la taille du bitstream : decode_bitstream_speculative() en choisit le nombre, les tests l'imposent
+// *sequential_fallback (s'il n'est pas NULL) indique si le bitstream a finalement été décodé séquentiellement
+int8_t decode_bitstream_speculative_chunks(struct JPEG *jpeg, size_t nb_chunks, bool *sequential_fallback);
+
+#endif
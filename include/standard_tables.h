@@ -0,0 +1,31 @@
+#ifndef _STANDARD_TABLES_H_
+#define _STANDARD_TABLES_H_
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+//**********************************************************************************************************************
+// Tables de Huffman "standard" (norme JPEG, annexe K.3), utilisées par la plupart des appareils photo et des encodeurs
+// Les flux Motion-JPEG les omettent souvent : une image sans DHT utilise alors ces tables
+// Format du contenu d'un segment DHT (après l'octet classe/destination) :
+// >>> 16 octets : nombre de codes de chaque longueur (1 à 16 bits)
+// >>> puis les symboles, dans l'ordre des codes
+struct StandardHuffmanTable {
+    int8_t class;               // 0 = DC, 1 = AC
+    int8_t destination;         // 0 = luminance, 1 = chrominance
+    size_t length;              // nombre d'octets de data
+    const unsigned char *data;
+};
+
+// Contenu des segments DHT des tables standard
+extern const unsigned char standard_DC_luminance[16 + 12];
+extern const unsigned char standard_DC_chrominance[16 + 12];
+extern const unsigned char standard_AC_luminance[16 + 162];
+extern const unsigned char standard_AC_chrominance[16 + 162];
+
+// Indexées comme les tables de la structure JPEG : DC luminance, DC chrominance, AC luminance, AC chrominance
+#define NB_OF_STANDARD_HUFFMAN_TABLES 4
+extern const struct StandardHuffmanTable standard_huffman_tables[NB_OF_STANDARD_HUFFMAN_TABLES];
+
+#endif
@@ -0,0 +1,49 @@
+#ifndef _STREAM_H_
+#define _STREAM_H_
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+// Taille des blocs lus quand le fichier ne peut pas être projeté en mémoire (pipe...)
+#define STREAM_READ_BLOCK_SIZE 65536
+
+
+//**********************************************************************************************************************
+// Source des octets du fichier JPEG
+// Le fichier est projeté en mémoire (mmap) : l'en-tête est lu directement dans la projection et les données
+// compressées n'y sont jamais recopiées (le lecteur de bits lit la projection, cf. bitreader.h)
+// Si la projection est impossible, le fichier est lu en entier dans un buffer
+// L'image peut aussi être déjà en mémoire (buffer fourni par l'appelant) : elle est alors lue sans copie
+enum StreamStorage {
+    STREAM_MAPPED,      // data vient de mmap()
+    STREAM_ALLOCATED,   // data vient de malloc()
+    STREAM_BORROWED     // data appartient à l'appelant : on ne la libère pas
+};
+
+struct ByteStream {
+    const unsigned char *data;
+    size_t size;
+    size_t position;    // prochain octet à lire
+    enum StreamStorage storage;
+};
+
+// Ouvre le fichier filename et rend tout son contenu accessible en mémoire
+// >>> header_only : seul le début du fichier sera lu (pas de lecture anticipée du reste du fichier)
+int8_t open_byte_stream(struct ByteStream *input, const char *filename, bool header_only);
+
+// Lit les size octets de data (qui doivent rester valides tant que le flux est utilisé)
+void open_memory_byte_stream(struct ByteStream *input, const unsigned char *data, size_t size);
+
+// Libère la projection (ou le buffer) du fichier
+void close_byte_stream(struct ByteStream *input);
+
+// Copie les nb_bytes prochains octets dans destination
+int8_t read_bytes(struct ByteStream *input, void *destination, size_t nb_bytes);
+
+// Saute les nb_bytes prochains octets
+int8_t ignore_bytes(struct ByteStream *input, size_t nb_bytes);
+
+#endif
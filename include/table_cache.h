@@ -0,0 +1,45 @@
+#ifndef _TABLE_CACHE_H_
+#define _TABLE_CACHE_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+
+// Nombre maximal de tables gardées par le cache (Huffman et quantification confondues)
+// Une fois plein, le cache n'accepte plus de tables : les suivantes restent propres à leur image
+#define TABLE_CACHE_SIZE 512
+
+
+//**********************************************************************************************************************
+// Cache des tables de Huffman et de quantification, partagé par toutes les images décodées par le processus
+// Un lot d'images qui viennent du même appareil (ou du même encodeur) redéfinit sans cesse les mêmes tables :
+// la première image construit la table, les suivantes la retrouvent par le contenu de son segment (clé hachée)
+// Les tables du cache ne sont jamais modifiées ni libérées : plusieurs images (et plusieurs threads) les partagent
+enum TableCacheKind {
+    TABLE_CACHE_HUFFMAN,
+    TABLE_CACHE_QUANTIZATION
+};
+
+// Nombre de tables trouvées dans le cache (hits) et construites faute de les y trouver (misses), par type de table
+struct TableCacheStatistics {
+    size_t huffman_hits;
+    size_t huffman_misses;
+    size_t quantization_hits;
+    size_t quantization_misses;
+    size_t nb_entries;
+};
+
+// Table associée au contenu key (key_length octets) du segment, ou NULL si elle n'est pas dans le cache (miss)
+void * table_cache_find(enum TableCacheKind kind, const unsigned char *key, size_t key_length);
+
+// Ajoute la table value, associée au contenu key du segment (recopié)
+// Renvoie la table du cache pour cette clé : value, ou celle qu'un autre thread a ajoutée entre-temps (value reste
+// alors à l'appelant) ; NULL si le cache est plein (value reste à l'appelant)
+void * table_cache_insert(enum TableCacheKind kind, const unsigned char *key, size_t key_length, void *value);
+
+// Compteurs du cache depuis le début du processus
+struct TableCacheStatistics get_table_cache_statistics();
+
+#endif
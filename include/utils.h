@@ -7,6 +7,7 @@
 #include <string.h>
 
 #include <extract.h>
+#include <verbose.h>
 
 #define NB_VALUES_IN_8x8_BLOCK 64
 #define COMPONENT_0_INDEX 0
@@ -21,6 +22,9 @@
 #define CYAN(string) "\x1b[36m" string "\x1b[0m"
 
 
+// Position (ordre naturel, ligne par ligne) du coefficient d'indice zigzag k dans un bloc 8x8
+extern const uint8_t zigzag_table[NB_VALUES_IN_8x8_BLOCK];
+
 // Check if memory allocation was successful
 int8_t check_memory_allocation(void *allocated_data);
 
@@ -1,6 +1,57 @@
 #ifndef _VERBOSE_H_
 #define _VERBOSE_H_
 #include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+
+//**********************************************************************************************************************
+// Codes d'erreur renvoyés par les étapes du décodage (de extract() à write_ppm(), ou jpeg_decode_mem())
+// Les catégories reprennent celles des messages d'erreur (ERROR : <CATEGORIE> - ...)
+enum DecoderStatus {
+    DECODER_OK = 0,
+    DECODER_ERROR_GLOBAL = 1,           // erreur non classée (= EXIT_FAILURE)
+    DECODER_ERROR_OPEN,                 // fichier introuvable ou impossible à ouvrir
+    DECODER_ERROR_READ,                 // lecture impossible (fichier tronqué...)
+    DECODER_ERROR_FORMAT,               // ce n'est pas un fichier JPEG (JFIF) pris en charge
+    DECODER_ERROR_INCONSISTENT_DATA,    // données JPEG invalides ou incohérentes
+    DECODER_ERROR_MEMORY,               // échec d'une allocation
+    DECODER_ERROR_WRITE,                // écriture du fichier de sortie impossible
+    DECODER_ERROR_ARGUMENT              // paramètre invalide (buffer de sortie trop petit...)
+};
+
+
+// Contexte d'un décodeur : options d'affichage et code de la première erreur rencontrée
+// >>> chaque décodeur (fichier en cours de décodage) a le sien, plusieurs décodeurs peuvent tourner en parallèle
+struct DecoderContext {
+    bool verbose;
+    bool highly_verbose;
+    int8_t status;
+};
+
+// Initialise un contexte (pas d'affichage, pas d'erreur)
+void initializeDecoderContext(struct DecoderContext *context);
+
+// Associe le contexte au thread courant : les fonctions ci-dessous (et getVerbose()...) l'utilisent ensuite
+// Sans contexte associé (NULL), chaque thread utilise un contexte par défaut qui lui est propre
+void bindDecoderContext(struct DecoderContext *context);
+
+// Contexte associé au thread courant
+struct DecoderContext * getDecoderContext();
+
+// Enregistre l'erreur status dans le contexte courant si aucune erreur n'y a encore été enregistrée
+// Renvoie le code de la première erreur enregistrée (la cause d'origine)
+int8_t setDecoderError(int8_t status);
+
+// Code de la première erreur enregistrée dans le contexte courant (DECODER_OK si aucune)
+int8_t getDecoderStatus();
+
+// Remet à zéro le code d'erreur du contexte courant (avant de décoder un nouveau fichier)
+void resetDecoderStatus();
+
+// Nom de la catégorie d'erreur associée au code status
+const char * getDecoderStatusName(int8_t status);
+
 
 void setVerbose(bool value);
 
@@ -0,0 +1,625 @@
+// Fichier généré par tools/generate_standard_tables.c : ne pas modifier
+#ifndef _STANDARD_HUFFMAN_TABLES_H_
+#define _STANDARD_HUFFMAN_TABLES_H_
+
+#define STANDARD_HUFFMAN_CANONICAL_0 { \
+    {0,-1,0,6,14,30,62,126,254,510,-1,-1,-1,-1,-1,-1,-1}, \
+    {0,0,0,-1,-8,-23,-54,-117,-244,-499,0,0,0,0,0,0,0}, \
+    { \
+        0,1,2,3,4,5,6,7,8,9,10,11,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}
+
+#define STANDARD_HUFFMAN_LOOKUP_0 { \
+    { \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,7,7,7,7,8,8,9,0}, \
+    { \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6, \
+        6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6, \
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, \
+        8,8,8,8,8,8,8,8,9,9,9,9,10,10,11,0}}
+
+#define STANDARD_AC_FAST_LOOKUP_0 {{ \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}}}
+
+#define STANDARD_HUFFMAN_CANONICAL_1 { \
+    {0,-1,2,6,14,30,62,126,254,510,1022,2046,-1,-1,-1,-1,-1}, \
+    {0,0,0,-3,-10,-25,-56,-119,-246,-501,-1012,-2035,0,0,0,0,0}, \
+    { \
+        0,1,2,3,4,5,6,7,8,9,10,11,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}
+
+#define STANDARD_HUFFMAN_LOOKUP_1 { \
+    { \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,7,7,7,7,8,8,9,0}, \
+    { \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,7,7,7,7,8,8,9,0}}
+
+#define STANDARD_AC_FAST_LOOKUP_1 {{ \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}}}
+
+#define STANDARD_HUFFMAN_CANONICAL_2 { \
+    {0,-1,1,4,12,28,59,123,250,506,1018,2041,4087,-1,-1,32704,65534}, \
+    {0,0,0,-2,-7,-20,-49,-109,-233,-484,-991,-2010,-4052,0,0,-32668,-65373}, \
+    { \
+        1,2,3,0,4,17,5,18,33,49,65,6,19,81,97,7, \
+        34,113,20,50,129,145,161,8,35,66,177,193,21,82,209,240, \
+        36,51,98,114,130,9,10,22,23,24,25,26,37,38,39,40, \
+        41,42,52,53,54,55,56,57,58,67,68,69,70,71,72,73, \
+        74,83,84,85,86,87,88,89,90,99,100,101,102,103,104,105, \
+        106,115,116,117,118,119,120,121,122,131,132,133,134,135,136,137, \
+        138,146,147,148,149,150,151,152,153,154,162,163,164,165,166,167, \
+        168,169,170,178,179,180,181,182,183,184,185,186,194,195,196,197, \
+        198,199,200,201,202,210,211,212,213,214,215,216,217,218,225,226, \
+        227,228,229,230,231,232,233,234,241,242,243,244,245,246,247,248, \
+        249,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}
+
+#define STANDARD_HUFFMAN_LOOKUP_2 { \
+    { \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6, \
+        7,7,7,7,7,7,7,7,7,7,7,7,7,7,7,7, \
+        8,8,8,8,8,8,9,9,9,9,9,0,0,0,0,0}, \
+    { \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17, \
+        17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        18,18,18,18,18,18,18,18,18,18,18,18,18,18,18,18, \
+        33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33, \
+        49,49,49,49,49,49,49,49,65,65,65,65,65,65,65,65, \
+        6,6,6,6,19,19,19,19,81,81,81,81,97,97,97,97, \
+        7,7,34,34,113,113,20,50,129,145,161,0,0,0,0,0}}
+
+#define STANDARD_AC_FAST_LOOKUP_2 {{ \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4}, \
+    {-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4}, \
+    {-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4}, \
+    {-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4},{-3,0,4}, \
+    {-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4}, \
+    {-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4}, \
+    {-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4}, \
+    {-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4},{-2,0,4}, \
+    {2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4}, \
+    {2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4}, \
+    {2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4}, \
+    {2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4},{2,0,4}, \
+    {3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4}, \
+    {3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4}, \
+    {3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4}, \
+    {3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4},{3,0,4}, \
+    {-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6},{-7,0,6}, \
+    {-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6},{-6,0,6}, \
+    {-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6},{-5,0,6}, \
+    {-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6},{-4,0,6}, \
+    {4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6},{4,0,6}, \
+    {5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6},{5,0,6}, \
+    {6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6},{6,0,6}, \
+    {7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6},{7,0,6}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {-15,0,8},{-15,0,8},{-15,0,8},{-15,0,8},{-14,0,8},{-14,0,8},{-14,0,8},{-14,0,8},{-13,0,8},{-13,0,8},{-13,0,8},{-13,0,8},{-12,0,8},{-12,0,8},{-12,0,8},{-12,0,8}, \
+    {-11,0,8},{-11,0,8},{-11,0,8},{-11,0,8},{-10,0,8},{-10,0,8},{-10,0,8},{-10,0,8},{-9,0,8},{-9,0,8},{-9,0,8},{-9,0,8},{-8,0,8},{-8,0,8},{-8,0,8},{-8,0,8}, \
+    {8,0,8},{8,0,8},{8,0,8},{8,0,8},{9,0,8},{9,0,8},{9,0,8},{9,0,8},{10,0,8},{10,0,8},{10,0,8},{10,0,8},{11,0,8},{11,0,8},{11,0,8},{11,0,8}, \
+    {12,0,8},{12,0,8},{12,0,8},{12,0,8},{13,0,8},{13,0,8},{13,0,8},{13,0,8},{14,0,8},{14,0,8},{14,0,8},{14,0,8},{15,0,8},{15,0,8},{15,0,8},{15,0,8}, \
+    {-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5}, \
+    {-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5}, \
+    {1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5}, \
+    {1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5}, \
+    {-31,0,10},{-30,0,10},{-29,0,10},{-28,0,10},{-27,0,10},{-26,0,10},{-25,0,10},{-24,0,10},{-23,0,10},{-22,0,10},{-21,0,10},{-20,0,10},{-19,0,10},{-18,0,10},{-17,0,10},{-16,0,10}, \
+    {16,0,10},{17,0,10},{18,0,10},{19,0,10},{20,0,10},{21,0,10},{22,0,10},{23,0,10},{24,0,10},{25,0,10},{26,0,10},{27,0,10},{28,0,10},{29,0,10},{30,0,10},{31,0,10}, \
+    {-3,1,7},{-3,1,7},{-3,1,7},{-3,1,7},{-3,1,7},{-3,1,7},{-3,1,7},{-3,1,7},{-2,1,7},{-2,1,7},{-2,1,7},{-2,1,7},{-2,1,7},{-2,1,7},{-2,1,7},{-2,1,7}, \
+    {2,1,7},{2,1,7},{2,1,7},{2,1,7},{2,1,7},{2,1,7},{2,1,7},{2,1,7},{3,1,7},{3,1,7},{3,1,7},{3,1,7},{3,1,7},{3,1,7},{3,1,7},{3,1,7}, \
+    {-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6}, \
+    {1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6}, \
+    {-1,3,7},{-1,3,7},{-1,3,7},{-1,3,7},{-1,3,7},{-1,3,7},{-1,3,7},{-1,3,7},{1,3,7},{1,3,7},{1,3,7},{1,3,7},{1,3,7},{1,3,7},{1,3,7},{1,3,7}, \
+    {-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{-7,1,10},{-6,1,10},{-5,1,10},{-4,1,10},{4,1,10},{5,1,10},{6,1,10},{7,1,10}, \
+    {-1,5,8},{-1,5,8},{-1,5,8},{-1,5,8},{1,5,8},{1,5,8},{1,5,8},{1,5,8},{-1,6,8},{-1,6,8},{-1,6,8},{-1,6,8},{1,6,8},{1,6,8},{1,6,8},{1,6,8}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{-3,2,10},{-2,2,10},{2,2,10},{3,2,10},{-1,7,9},{-1,7,9},{1,7,9},{1,7,9},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {-1,8,10},{1,8,10},{-1,9,10},{1,9,10},{-1,10,10},{1,10,10},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}}}
+
+#define STANDARD_HUFFMAN_CANONICAL_3 { \
+    {0,-1,1,4,11,27,59,122,249,506,1018,2041,4087,-1,16352,32707,65534}, \
+    {0,0,0,-2,-7,-19,-47,-107,-230,-480,-987,-2006,-4048,0,-16312,-32665,-65373}, \
+    { \
+        0,1,2,3,17,4,5,33,49,6,18,65,81,7,97,113, \
+        19,34,50,129,8,20,66,145,161,177,193,9,35,51,82,240, \
+        21,98,114,209,10,22,36,52,225,37,241,23,24,25,26,38, \
+        39,40,41,42,53,54,55,56,57,58,67,68,69,70,71,72, \
+        73,74,83,84,85,86,87,88,89,90,99,100,101,102,103,104, \
+        105,106,115,116,117,118,119,120,121,122,130,131,132,133,134,135, \
+        136,137,138,146,147,148,149,150,151,152,153,154,162,163,164,165, \
+        166,167,168,169,170,178,179,180,181,182,183,184,185,186,194,195, \
+        196,197,198,199,200,201,202,210,211,212,213,214,215,216,217,218, \
+        226,227,228,229,230,231,232,233,234,242,243,244,245,246,247,248, \
+        249,250,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0}}
+
+#define STANDARD_HUFFMAN_LOOKUP_3 { \
+    { \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6, \
+        6,6,6,6,6,6,6,6,6,6,6,6,6,6,6,6, \
+        7,7,7,7,7,7,7,7,7,7,7,7,8,8,8,8, \
+        8,8,8,8,9,9,9,9,9,9,9,0,0,0,0,0}, \
+    { \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        1,1,1,1,1,1,1,1,1,1,1,1,1,1,1,1, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        2,2,2,2,2,2,2,2,2,2,2,2,2,2,2,2, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        3,3,3,3,3,3,3,3,3,3,3,3,3,3,3,3, \
+        17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17, \
+        17,17,17,17,17,17,17,17,17,17,17,17,17,17,17,17, \
+        4,4,4,4,4,4,4,4,4,4,4,4,4,4,4,4, \
+        5,5,5,5,5,5,5,5,5,5,5,5,5,5,5,5, \
+        33,33,33,33,33,33,33,33,33,33,33,33,33,33,33,33, \
+        49,49,49,49,49,49,49,49,49,49,49,49,49,49,49,49, \
+        6,6,6,6,6,6,6,6,18,18,18,18,18,18,18,18, \
+        65,65,65,65,65,65,65,65,81,81,81,81,81,81,81,81, \
+        7,7,7,7,97,97,97,97,113,113,113,113,19,19,34,34, \
+        50,50,129,129,8,20,66,145,161,177,193,0,0,0,0,0}}
+
+#define STANDARD_AC_FAST_LOOKUP_3 {{ \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3},{-1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3},{1,0,3}, \
+    {-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5}, \
+    {-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5},{-3,0,5}, \
+    {-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5}, \
+    {-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5},{-2,0,5}, \
+    {2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5}, \
+    {2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5},{2,0,5}, \
+    {3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5}, \
+    {3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5},{3,0,5}, \
+    {-7,0,7},{-7,0,7},{-7,0,7},{-7,0,7},{-7,0,7},{-7,0,7},{-7,0,7},{-7,0,7},{-6,0,7},{-6,0,7},{-6,0,7},{-6,0,7},{-6,0,7},{-6,0,7},{-6,0,7},{-6,0,7}, \
+    {-5,0,7},{-5,0,7},{-5,0,7},{-5,0,7},{-5,0,7},{-5,0,7},{-5,0,7},{-5,0,7},{-4,0,7},{-4,0,7},{-4,0,7},{-4,0,7},{-4,0,7},{-4,0,7},{-4,0,7},{-4,0,7}, \
+    {4,0,7},{4,0,7},{4,0,7},{4,0,7},{4,0,7},{4,0,7},{4,0,7},{4,0,7},{5,0,7},{5,0,7},{5,0,7},{5,0,7},{5,0,7},{5,0,7},{5,0,7},{5,0,7}, \
+    {6,0,7},{6,0,7},{6,0,7},{6,0,7},{6,0,7},{6,0,7},{6,0,7},{6,0,7},{7,0,7},{7,0,7},{7,0,7},{7,0,7},{7,0,7},{7,0,7},{7,0,7},{7,0,7}, \
+    {-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5}, \
+    {-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5},{-1,1,5}, \
+    {1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5}, \
+    {1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5},{1,1,5}, \
+    {-15,0,9},{-15,0,9},{-14,0,9},{-14,0,9},{-13,0,9},{-13,0,9},{-12,0,9},{-12,0,9},{-11,0,9},{-11,0,9},{-10,0,9},{-10,0,9},{-9,0,9},{-9,0,9},{-8,0,9},{-8,0,9}, \
+    {8,0,9},{8,0,9},{9,0,9},{9,0,9},{10,0,9},{10,0,9},{11,0,9},{11,0,9},{12,0,9},{12,0,9},{13,0,9},{13,0,9},{14,0,9},{14,0,9},{15,0,9},{15,0,9}, \
+    {-31,0,10},{-30,0,10},{-29,0,10},{-28,0,10},{-27,0,10},{-26,0,10},{-25,0,10},{-24,0,10},{-23,0,10},{-22,0,10},{-21,0,10},{-20,0,10},{-19,0,10},{-18,0,10},{-17,0,10},{-16,0,10}, \
+    {16,0,10},{17,0,10},{18,0,10},{19,0,10},{20,0,10},{21,0,10},{22,0,10},{23,0,10},{24,0,10},{25,0,10},{26,0,10},{27,0,10},{28,0,10},{29,0,10},{30,0,10},{31,0,10}, \
+    {-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6},{-1,2,6}, \
+    {1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6},{1,2,6}, \
+    {-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6},{-1,3,6}, \
+    {1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6},{1,3,6}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}, \
+    {-3,1,8},{-3,1,8},{-3,1,8},{-3,1,8},{-2,1,8},{-2,1,8},{-2,1,8},{-2,1,8},{2,1,8},{2,1,8},{2,1,8},{2,1,8},{3,1,8},{3,1,8},{3,1,8},{3,1,8}, \
+    {-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{-1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7},{1,4,7}, \
+    {-1,5,7},{-1,5,7},{-1,5,7},{-1,5,7},{-1,5,7},{-1,5,7},{-1,5,7},{-1,5,7},{1,5,7},{1,5,7},{1,5,7},{1,5,7},{1,5,7},{1,5,7},{1,5,7},{1,5,7}, \
+    {0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{-1,6,8},{-1,6,8},{-1,6,8},{-1,6,8},{1,6,8},{1,6,8},{1,6,8},{1,6,8}, \
+    {-1,7,8},{-1,7,8},{-1,7,8},{-1,7,8},{1,7,8},{1,7,8},{1,7,8},{1,7,8},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{-3,2,10},{-2,2,10},{2,2,10},{3,2,10}, \
+    {-3,3,10},{-2,3,10},{2,3,10},{3,3,10},{-1,8,9},{-1,8,9},{1,8,9},{1,8,9},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{-1,9,10},{1,9,10}, \
+    {-1,10,10},{1,10,10},{-1,11,10},{1,11,10},{-1,12,10},{1,12,10},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0},{0,0,0}}}
+
+#endif
@@ -5,9 +5,13 @@
 
 #include <IDCT.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IDCT_X86
+#endif
+
 
 // double C_cos_values[N][N][N][N];
-const float sqrt_2 = 1.41421356237309504880168872420;
 
 
 // //*********************************************************************************************************************************************************************************************
@@ -142,187 +146,466 @@ const float sqrt_2 = 1.41421356237309504880168872420;
 
 
 //*********************************************************************************************************************************************************************************************
-// FAST IDCT
-
-// cos_table[i] = cos(i*pi/16)
-const float cos_table[9] = {1.0,
-			               0.98078528040323044912618223613,
-			               0.92387953251128675612818318939,
-			               0.83146961230254523707878837761,
-			               0.70170678118654752440084436210,
-			               0.55557023301960222474283081394,
-			               0.38268343236508977172845998403,
-			               0.19509032201612826784828486847,
-			               0.0};
-
-
-// Inverse du module papillon de loeffler pour récupérer I0
-float papillon_inv_I0(float O0, float O1){
-    return (O0 + O1)/2;
+// FAST IDCT : IDCT entière en virgule fixe, même schéma que l'IDCT "islow" de la libjpeg (jidctint.c)
+// Les constantes sont arrondies à 2^-CONST_BITS près : tous les calculs sont exacts sur des entiers 32 bits (aucun
+// débordement tant que les entrées de chaque passe tiennent sur 16 bits), le résultat ne dépend donc pas du compilateur
+// >>> passe 1 sur les colonnes : résultats multipliés par 2^PASS1_BITS, saturés sur 16 bits
+// >>> passe 2 sur les lignes : division par 2^(CONST_BITS + PASS1_BITS + 3) (le 3 est le facteur 1/8 de l'IDCT 2D),
+//     +128 et écrêtage par la table range_limit
+// Les coefficients arrivent déjà déquantifiés (cf. decode_MCU() et IQ())
+
+#define CONST_BITS 13
+#define PASS1_BITS 2
+
+// FIX(x) = round(x * 2^CONST_BITS)
+#define FIX_0_298631336 ((int32_t) 2446)
+#define FIX_0_390180644 ((int32_t) 3196)
+#define FIX_0_541196100 ((int32_t) 4433)
+#define FIX_0_765366865 ((int32_t) 6270)
+#define FIX_0_899976223 ((int32_t) 7373)
+#define FIX_1_175875602 ((int32_t) 9633)
+#define FIX_1_501321110 ((int32_t) 12299)
+#define FIX_1_847759065 ((int32_t) 15137)
+#define FIX_1_961570560 ((int32_t) 16069)
+#define FIX_2_053119869 ((int32_t) 16819)
+#define FIX_2_562915447 ((int32_t) 20995)
+#define FIX_3_072711026 ((int32_t) 25172)
+
+// Division arrondie par 2^n (décalage arithmétique des entiers négatifs : gcc, clang et msvc)
+#define DESCALE(x, n) (((x) + ((int32_t) 1 << ((n) - 1))) >> (n))
+
+
+// Écrêtage à [0, 255] d'une valeur x + 128 prise modulo 1024 (même table que la libjpeg) :
+// >>> 0..255 : valeur normale, 256..639 : dépassement par le haut (255), 640..1023 : dépassement par le bas (0)
+// Seules des données corrompues peuvent sortir de [-512, 511] et être repliées par le modulo
+#define RANGE_MASK 1023
+#define REPEAT_8(x) x, x, x, x, x, x, x, x
+#define REPEAT_128(x) REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), \
+                      REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x), REPEAT_8(x)
+
+static const uint8_t range_limit[RANGE_MASK + 1] = {
+      0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+     16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+     32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+     48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,
+     64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,
+     80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,
+     96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111,
+    112, 113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127,
+    128, 129, 130, 131, 132, 133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143,
+    144, 145, 146, 147, 148, 149, 150, 151, 152, 153, 154, 155, 156, 157, 158, 159,
+    160, 161, 162, 163, 164, 165, 166, 167, 168, 169, 170, 171, 172, 173, 174, 175,
+    176, 177, 178, 179, 180, 181, 182, 183, 184, 185, 186, 187, 188, 189, 190, 191,
+    192, 193, 194, 195, 196, 197, 198, 199, 200, 201, 202, 203, 204, 205, 206, 207,
+    208, 209, 210, 211, 212, 213, 214, 215, 216, 217, 218, 219, 220, 221, 222, 223,
+    224, 225, 226, 227, 228, 229, 230, 231, 232, 233, 234, 235, 236, 237, 238, 239,
+    240, 241, 242, 243, 244, 245, 246, 247, 248, 249, 250, 251, 252, 253, 254, 255,
+    REPEAT_128(255), REPEAT_128(255), REPEAT_128(255),
+    REPEAT_128(0), REPEAT_128(0), REPEAT_128(0)
+};
+
+
+// Pour chaque indice zigzag k : plus grand numéro de ligne parmi les coefficients d'indice zigzag <= k
+// >>> si le dernier coefficient non nul d'un bloc est d'indice k, les lignes suivantes sont entièrement nulles
+const uint8_t zigzag_last_row[NN] = {
+    0, 0, 1, 2, 2, 2, 2, 2,
+    2, 3, 4, 4, 4, 4, 4, 4,
+    4, 4, 4, 4, 5, 6, 6, 6,
+    6, 6, 6, 6, 6, 6, 6, 6,
+    6, 6, 6, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7
+};
+
+
+// Pour chaque indice zigzag k : plus grand numéro de colonne parmi les coefficients d'indice zigzag <= k
+const uint8_t zigzag_last_column[NN] = {
+    0, 1, 1, 1, 1, 2, 3, 3,
+    3, 3, 3, 3, 3, 3, 4, 5,
+    5, 5, 5, 5, 5, 5, 5, 5,
+    5, 5, 5, 6, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7,
+    7, 7, 7, 7, 7, 7, 7, 7
+};
+
+
+static inline int16_t saturate_int16(int32_t x){
+    return (x > INT16_MAX) ? INT16_MAX : (x < INT16_MIN) ? INT16_MIN : (int16_t) x;
 }
 
 
-// Inverse du module papillon de loeffler pour récupérer I1
-float papillon_inv_I1(float O0, float O1){
-    return (O0 - O1)/2;
+// IDCT 1D sur 8 valeurs (à un facteur sqrt(8) * 2^CONST_BITS près), sans la division finale
+static inline void islow_IDCT_1D(int32_t in0, int32_t in1, int32_t in2, int32_t in3,
+                                 int32_t in4, int32_t in5, int32_t in6, int32_t in7, int32_t out[8]){
+
+    // Partie paire : rotation de in2/in6 et papillon de in0/in4
+    int32_t z1 = (in2 + in6) * FIX_0_541196100;
+    int32_t tmp2 = z1 - in6 * FIX_1_847759065;
+    int32_t tmp3 = z1 + in2 * FIX_0_765366865;
+
+    int32_t tmp0 = (in0 + in4) * (1 << CONST_BITS);
+    int32_t tmp1 = (in0 - in4) * (1 << CONST_BITS);
+
+    int32_t tmp10 = tmp0 + tmp3;
+    int32_t tmp13 = tmp0 - tmp3;
+    int32_t tmp11 = tmp1 + tmp2;
+    int32_t tmp12 = tmp1 - tmp2;
+
+    // Partie impaire : in7, in5, in3, in1
+    z1 = in7 + in1;
+    int32_t z2 = in5 + in3;
+    int32_t z3 = in7 + in3;
+    int32_t z4 = in5 + in1;
+    int32_t z5 = (z3 + z4) * FIX_1_175875602;
+
+    tmp0 = in7 * FIX_0_298631336;
+    tmp1 = in5 * FIX_2_053119869;
+    tmp2 = in3 * FIX_3_072711026;
+    tmp3 = in1 * FIX_1_501321110;
+    z1 *= -FIX_0_899976223;
+    z2 *= -FIX_2_562915447;
+    z3 = z3 * -FIX_1_961570560 + z5;
+    z4 = z4 * -FIX_0_390180644 + z5;
+
+    tmp0 += z1 + z3;
+    tmp1 += z2 + z4;
+    tmp2 += z2 + z3;
+    tmp3 += z1 + z4;
+
+    // Papillons de sortie
+    out[0] = tmp10 + tmp3;
+    out[7] = tmp10 - tmp3;
+    out[1] = tmp11 + tmp2;
+    out[6] = tmp11 - tmp2;
+    out[2] = tmp12 + tmp1;
+    out[5] = tmp12 - tmp1;
+    out[3] = tmp13 + tmp0;
+    out[4] = tmp13 - tmp0;
 }
 
 
-// Inverse du module rotation de loeffler pour récupérer I0
-float rotation_inv_I0(float O0, float O1, float k, uint8_t num_coef){
-    return 1.0/k * (O0 *  cos_table[num_coef] - O1 * cos_table[8 - num_coef]);
+// Bloc DC seul : toutes les valeurs de sortie sont égales (même résultat exact que l'IDCT complète)
+static inline void IDCT_DC_only(int16_t *block){
+    int16_t DC = saturate_int16((int32_t) block[0] * (1 << PASS1_BITS));
+    int16_t pixel = range_limit[(DESCALE((int32_t) DC, PASS1_BITS + 3) + 128) & RANGE_MASK];
+    for (uint8_t i = 0; i < NN; i++) {
+        block[i] = pixel;
+    }
 }
 
 
-// Inverse du module rotation de loeffler pour récupérer I1
-float rotation_inv_I1(float O0, float O1, float k, uint8_t num_coef){
-    return 1.0/k * (O1 *  cos_table[num_coef] + O0 * cos_table[8 - num_coef]);
+// Fast Inverse Discrete Cosine Transform function (entière, cf. islow_IDCT_1D())
+int8_t fast_IDCT_function(int16_t **input){
+    return fast_IDCT_function_sparse(input, NN - 1);
 }
 
 
-// Fast Inverse Discrete Cosine Transform function using Loeffler algorithm
-int8_t fast_IDCT_function(int16_t **input){
-    
-    // passage en float
-    float input_float[8][8];
-    for (uint8_t i = 0; i<8; i++){
-        for (uint8_t j = 0; j<8; j++){
-            input_float[i][j] = (float) (*input)[i * 8 + j];
+// IDCT d'un bloc dont les coefficients d'indice (zigzag) > last_nonzero sont nuls
+// >>> bloc DC seul : cf. IDCT_DC_only()
+// >>> sinon, les colonnes nulles ou dont seul le premier coefficient est non nul sont recopiées directement, de même
+//     pour les lignes de la passe 2, et l'IDCT 1D ne reçoit que 4 valeurs quand les 4 dernières sont nulles
+//     (islow_IDCT_1D() est inline : les termes nuls disparaissent à la compilation) : mêmes résultats exacts
+int8_t fast_IDCT_function_sparse(int16_t **input, uint8_t last_nonzero){
+    int16_t *block = *input;
+
+    if (last_nonzero == 0) {
+        IDCT_DC_only(block);
+        return EXIT_SUCCESS;
+    }
+    uint8_t last_row = zigzag_last_row[last_nonzero];
+    uint8_t last_column = zigzag_last_column[last_nonzero];
+
+    // Passe 1 : colonnes (celles après last_column sont nulles)
+    int16_t workspace[NN];
+    int32_t out[8];
+    for (uint8_t c = last_column + 1; c < 8; c++) {
+        for (uint8_t r = 0; r < 8; r++) {
+            workspace[r * 8 + c] = 0;
+        }
+    }
+    for (uint8_t c = 0; c <= last_column; c++) {
+        bool only_DC = true;
+        for (uint8_t r = 1; r <= last_row; r++) {
+            if (block[r * 8 + c] != 0) {
+                only_DC = false;
+                break;
+            }
+        }
+        if (only_DC) {
+            int16_t value = saturate_int16((int32_t) block[c] * (1 << PASS1_BITS));
+            for (uint8_t r = 0; r < 8; r++) {
+                workspace[r * 8 + c] = value;
+            }
+            continue;
+        }
+
+        if (last_row < 4) {
+            islow_IDCT_1D(block[c], block[8 + c], block[16 + c], block[24 + c], 0, 0, 0, 0, out);
+        } else {
+            islow_IDCT_1D(block[c], block[8 + c], block[16 + c], block[24 + c], block[32 + c], block[40 + c], block[48 + c], block[56 + c], out);
+        }
+        for (uint8_t r = 0; r < 8; r++) {
+            workspace[r * 8 + c] = saturate_int16(DESCALE(out[r], CONST_BITS - PASS1_BITS));
         }
     }
 
-    // On applique l'IDCT_1D sur les lignes
-    for (uint8_t i = 0; i<8; i++){
-
-        // vecteur temporaire pour stocker les valeurs intermédiaires
-        float temp[8];
-
-        // 1st step
-        temp[0] = input_float[i][0];
-        temp[1] = input_float[i][4];
-        temp[2] = input_float[i][2];
-        temp[3] = input_float[i][6];
-        temp[4] = papillon_inv_I1(input_float[i][1], input_float[i][7]);
-        temp[5] = input_float[i][3] / sqrt_2;
-        temp[6] = input_float[i][5] / sqrt_2;
-        temp[7] = papillon_inv_I0(input_float[i][1], input_float[i][7]);
-
-        // 2nd step
-        input_float[i][0] = papillon_inv_I0(temp[0], temp[1]);
-        input_float[i][1] = papillon_inv_I1(temp[0], temp[1]);
-        input_float[i][2] = rotation_inv_I0(temp[2], temp[3], sqrt_2, 6);
-        input_float[i][3] = rotation_inv_I1(temp[2], temp[3], sqrt_2, 6);
-        input_float[i][4] = papillon_inv_I0(temp[4], temp[6]);
-        input_float[i][5] = papillon_inv_I1(temp[7], temp[5]);
-        input_float[i][6] = papillon_inv_I1(temp[4], temp[6]);
-        input_float[i][7] = papillon_inv_I0(temp[7], temp[5]);
-
-        // 3rd step
-        temp[0] = papillon_inv_I0(input_float[i][0], input_float[i][3]);
-        temp[1] = papillon_inv_I0(input_float[i][1], input_float[i][2]);
-        temp[2] = papillon_inv_I1(input_float[i][1], input_float[i][2]);
-        temp[3] = papillon_inv_I1(input_float[i][0], input_float[i][3]);
-        temp[4] = rotation_inv_I0(input_float[i][4], input_float[i][7], 1.0, 3);
-        temp[5] = rotation_inv_I0(input_float[i][5], input_float[i][6], 1.0, 1);
-        temp[6] = rotation_inv_I1(input_float[i][5], input_float[i][6], 1.0, 1);
-        temp[7] = rotation_inv_I1(input_float[i][4], input_float[i][7], 1.0, 3);
-
-        // 4th step
-        input_float[i][0] = papillon_inv_I0(temp[0], temp[7]);
-        input_float[i][1] = papillon_inv_I0(temp[1], temp[6]);
-        input_float[i][2] = papillon_inv_I0(temp[2], temp[5]);
-        input_float[i][3] = papillon_inv_I0(temp[3], temp[4]);
-        input_float[i][4] = papillon_inv_I1(temp[3], temp[4]);
-        input_float[i][5] = papillon_inv_I1(temp[2], temp[5]);
-        input_float[i][6] = papillon_inv_I1(temp[1], temp[6]);
-        input_float[i][7] = papillon_inv_I1(temp[0], temp[7]);
+    // Passe 2 : lignes, puis +128 et écrêtage
+    for (uint8_t r = 0; r < 8; r++) {
+        const int16_t *row = &workspace[r * 8];
+        int16_t *pixels = &block[r * 8];
+
+        if ((row[1] | row[2] | row[3] | row[4] | row[5] | row[6] | row[7]) == 0) {
+            int16_t pixel = range_limit[(DESCALE((int32_t) row[0], PASS1_BITS + 3) + 128) & RANGE_MASK];
+            for (uint8_t c = 0; c < 8; c++) {
+                pixels[c] = pixel;
+            }
+            continue;
+        }
+
+        if (last_column < 4) {
+            islow_IDCT_1D(row[0], row[1], row[2], row[3], 0, 0, 0, 0, out);
+        } else {
+            islow_IDCT_1D(row[0], row[1], row[2], row[3], row[4], row[5], row[6], row[7], out);
+        }
+        for (uint8_t c = 0; c < 8; c++) {
+            pixels[c] = range_limit[(DESCALE(out[c], CONST_BITS + PASS1_BITS + 3) + 128) & RANGE_MASK];
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
+
+
+//*********************************************************************************************************************************************************************************************
+// IDCT AVX2 : même calcul que fast_IDCT_function_sparse() (résultat identique au bit près), tout le bloc reste en registres
+// >>> les 8 lignes du bloc sont 8 registres de 8 entiers 16 bits : une IDCT 1D traite les 8 colonnes à la fois
+// >>> les produits sont faits par paires d'entrées (madd : a * x + b * y sur 32 bits) : les constantes de islow_IDCT_1D()
+//     sont regroupées par entrée (in2 * FIX_0_765366865 + (in2 + in6) * FIX_0_541196100 = in2 * 10703 + in6 * 4433, ...)
+//     pour ne jamais additionner deux entrées sur 16 bits (pas de débordement : mêmes calculs exacts qu'en scalaire)
+// >>> passe 1 (colonnes), packs = saturate_int16(), transposition en registres, passe 2 (lignes), écrêtage de range_limit[],
+//     transposition, puis packus vers des échantillons 8 bits, élargis sur 16 bits pour être rangés dans le bloc
+#ifdef IDCT_X86
+
+// Paire de constantes 16 bits (a pour la première entrée, b pour la seconde) répétée dans chaque mot de 32 bits
+#define IDCT_PAIR(a, b) _mm256_set1_epi32((int32_t) (((uint32_t) (uint16_t) (b) << 16) | (uint16_t) (a)))
+
+// Entrées x et y entrelacées sur 32 bits (colonnes 0..3 puis 4..7) : prêtes pour _mm256_madd_epi16()
+__attribute__((target("avx2")))
+static inline __m256i IDCT_interleave_avx2(__m128i x, __m128i y){
+    return _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_unpacklo_epi16(x, y)), _mm_unpackhi_epi16(x, y), 1);
+}
+
+// Ramène les 8 résultats 32 bits (colonnes 0..7) sur 16 bits avec saturation
+__attribute__((target("avx2")))
+static inline __m128i IDCT_packs_avx2(__m256i x){
+    return _mm_packs_epi32(_mm256_castsi256_si128(x), _mm256_extracti128_si256(x, 1));
+}
+
+// Transposition 8x8 d'entiers 16 bits
+__attribute__((target("avx2")))
+static inline void IDCT_transpose_avx2(__m128i rows[8]){
+    __m128i a0 = _mm_unpacklo_epi16(rows[0], rows[1]);
+    __m128i a1 = _mm_unpackhi_epi16(rows[0], rows[1]);
+    __m128i a2 = _mm_unpacklo_epi16(rows[2], rows[3]);
+    __m128i a3 = _mm_unpackhi_epi16(rows[2], rows[3]);
+    __m128i a4 = _mm_unpacklo_epi16(rows[4], rows[5]);
+    __m128i a5 = _mm_unpackhi_epi16(rows[4], rows[5]);
+    __m128i a6 = _mm_unpacklo_epi16(rows[6], rows[7]);
+    __m128i a7 = _mm_unpackhi_epi16(rows[6], rows[7]);
+
+    __m128i b0 = _mm_unpacklo_epi32(a0, a2);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a2);
+    __m128i b2 = _mm_unpacklo_epi32(a1, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a1, a3);
+    __m128i b4 = _mm_unpacklo_epi32(a4, a6);
+    __m128i b5 = _mm_unpackhi_epi32(a4, a6);
+    __m128i b6 = _mm_unpacklo_epi32(a5, a7);
+    __m128i b7 = _mm_unpackhi_epi32(a5, a7);
+
+    rows[0] = _mm_unpacklo_epi64(b0, b4);
+    rows[1] = _mm_unpackhi_epi64(b0, b4);
+    rows[2] = _mm_unpacklo_epi64(b1, b5);
+    rows[3] = _mm_unpackhi_epi64(b1, b5);
+    rows[4] = _mm_unpacklo_epi64(b2, b6);
+    rows[5] = _mm_unpackhi_epi64(b2, b6);
+    rows[6] = _mm_unpacklo_epi64(b3, b7);
+    rows[7] = _mm_unpackhi_epi64(b3, b7);
+}
+
+// IDCT 1D des 8 colonnes (cf. islow_IDCT_1D()) : in[k] = ligne k, out[k] = ligne k sur 32 bits, sans la division finale
+__attribute__((target("avx2")))
+static inline void islow_IDCT_1D_avx2(const __m128i in[8], __m256i out[8]){
+
+    // Partie paire : in0/in4 et in2/in6
+    __m256i in04 = IDCT_interleave_avx2(in[0], in[4]);
+    __m256i in26 = IDCT_interleave_avx2(in[2], in[6]);
+    __m256i tmp0 = _mm256_madd_epi16(in04, IDCT_PAIR(1 << CONST_BITS, 1 << CONST_BITS));
+    __m256i tmp1 = _mm256_madd_epi16(in04, IDCT_PAIR(1 << CONST_BITS, -(1 << CONST_BITS)));
+    __m256i tmp2 = _mm256_madd_epi16(in26, IDCT_PAIR(FIX_0_541196100, FIX_0_541196100 - FIX_1_847759065));
+    __m256i tmp3 = _mm256_madd_epi16(in26, IDCT_PAIR(FIX_0_541196100 + FIX_0_765366865, FIX_0_541196100));
+
+    __m256i tmp10 = _mm256_add_epi32(tmp0, tmp3);
+    __m256i tmp13 = _mm256_sub_epi32(tmp0, tmp3);
+    __m256i tmp11 = _mm256_add_epi32(tmp1, tmp2);
+    __m256i tmp12 = _mm256_sub_epi32(tmp1, tmp2);
+
+    // Partie impaire : in1/in3 et in5/in7 (z1..z5 développés dans les coefficients de chaque entrée)
+    __m256i in13 = IDCT_interleave_avx2(in[1], in[3]);
+    __m256i in57 = IDCT_interleave_avx2(in[5], in[7]);
+    tmp0 = _mm256_add_epi32(
+        _mm256_madd_epi16(in13, IDCT_PAIR(FIX_1_175875602 - FIX_0_899976223, FIX_1_175875602 - FIX_1_961570560)),
+        _mm256_madd_epi16(in57, IDCT_PAIR(FIX_1_175875602, FIX_0_298631336 - FIX_0_899976223 + FIX_1_175875602 - FIX_1_961570560)));
+    tmp1 = _mm256_add_epi32(
+        _mm256_madd_epi16(in13, IDCT_PAIR(FIX_1_175875602 - FIX_0_390180644, FIX_1_175875602 - FIX_2_562915447)),
+        _mm256_madd_epi16(in57, IDCT_PAIR(FIX_2_053119869 - FIX_2_562915447 + FIX_1_175875602 - FIX_0_390180644, FIX_1_175875602)));
+    tmp2 = _mm256_add_epi32(
+        _mm256_madd_epi16(in13, IDCT_PAIR(FIX_1_175875602, FIX_3_072711026 - FIX_2_562915447 + FIX_1_175875602 - FIX_1_961570560)),
+        _mm256_madd_epi16(in57, IDCT_PAIR(FIX_1_175875602 - FIX_2_562915447, FIX_1_175875602 - FIX_1_961570560)));
+    tmp3 = _mm256_add_epi32(
+        _mm256_madd_epi16(in13, IDCT_PAIR(FIX_1_501321110 - FIX_0_899976223 + FIX_1_175875602 - FIX_0_390180644, FIX_1_175875602)),
+        _mm256_madd_epi16(in57, IDCT_PAIR(FIX_1_175875602 - FIX_0_390180644, FIX_1_175875602 - FIX_0_899976223)));
+
+    // Papillons de sortie
+    out[0] = _mm256_add_epi32(tmp10, tmp3);
+    out[7] = _mm256_sub_epi32(tmp10, tmp3);
+    out[1] = _mm256_add_epi32(tmp11, tmp2);
+    out[6] = _mm256_sub_epi32(tmp11, tmp2);
+    out[2] = _mm256_add_epi32(tmp12, tmp1);
+    out[5] = _mm256_sub_epi32(tmp12, tmp1);
+    out[3] = _mm256_add_epi32(tmp13, tmp0);
+    out[4] = _mm256_sub_epi32(tmp13, tmp0);
+}
+
+// IDCT AVX2 d'un bloc dont les coefficients d'indice (zigzag) > last_nonzero sont nuls (seul le bloc DC seul est traité à part)
+__attribute__((target("avx2")))
+static int8_t fast_IDCT_function_avx2(int16_t **input, uint8_t last_nonzero){
+    int16_t *block = *input;
 
+    if (last_nonzero == 0) {
+        IDCT_DC_only(block);
+        return EXIT_SUCCESS;
     }
 
-    // On applique l'IDCT_1D sur les colonnes
-    for (uint8_t i = 0; i<8; i++ ){
-            
-        // vecteur temporaire pour stocker les valeurs intermédiaires
-        float temp[8];
-
-        // 1st step
-        temp[0] = input_float[0][i];
-        temp[1] = input_float[4][i];
-        temp[2] = input_float[2][i];
-        temp[3] = input_float[6][i];
-        temp[4] = papillon_inv_I1(input_float[1][i], input_float[7][i]);
-        temp[5] = input_float[3][i] / sqrt_2;
-        temp[6] = input_float[5][i] / sqrt_2;
-        temp[7] = papillon_inv_I0(input_float[1][i], input_float[7][i]);
-
-        // 2nd step
-        input_float[0][i] = papillon_inv_I0(temp[0], temp[1]);
-        input_float[1][i] = papillon_inv_I1(temp[0], temp[1]);
-        input_float[2][i] = rotation_inv_I0(temp[2], temp[3], sqrt_2, 6);
-        input_float[3][i] = rotation_inv_I1(temp[2], temp[3], sqrt_2, 6);
-        input_float[4][i] = papillon_inv_I0(temp[4], temp[6]);
-        input_float[5][i] = papillon_inv_I1(temp[7], temp[5]);
-        input_float[6][i] = papillon_inv_I1(temp[4], temp[6]);
-        input_float[7][i] = papillon_inv_I0(temp[7], temp[5]);
-
-        // 3rd step
-        temp[0] = papillon_inv_I0(input_float[0][i], input_float[3][i]);
-        temp[1] = papillon_inv_I0(input_float[1][i], input_float[2][i]);
-        temp[2] = papillon_inv_I1(input_float[1][i], input_float[2][i]);
-        temp[3] = papillon_inv_I1(input_float[0][i], input_float[3][i]);
-        temp[4] = rotation_inv_I0(input_float[4][i], input_float[7][i], 1.0, 3);
-        temp[5] = rotation_inv_I0(input_float[5][i], input_float[6][i], 1.0, 1);
-        temp[6] = rotation_inv_I1(input_float[5][i], input_float[6][i], 1.0, 1);
-        temp[7] = rotation_inv_I1(input_float[4][i], input_float[7][i], 1.0, 3);
-
-        // 4th step
-        input_float[0][i] = papillon_inv_I0(temp[0], temp[7]);
-        input_float[1][i] = papillon_inv_I0(temp[1], temp[6]);
-        input_float[2][i] = papillon_inv_I0(temp[2], temp[5]);
-        input_float[3][i] = papillon_inv_I0(temp[3], temp[4]);
-        input_float[4][i] = papillon_inv_I1(temp[3], temp[4]);
-        input_float[5][i] = papillon_inv_I1(temp[2], temp[5]);
-        input_float[6][i] = papillon_inv_I1(temp[1], temp[6]);
-        input_float[7][i] = papillon_inv_I1(temp[0], temp[7]);
+    __m128i rows[8];
+    __m256i out[8];
+    for (uint8_t r = 0; r < 8; r++) {
+        rows[r] = _mm_loadu_si128((const __m128i *) (block + r * 8));
+    }
 
+    // Passe 1 : colonnes, DESCALE(x, CONST_BITS - PASS1_BITS) puis saturation sur 16 bits
+    islow_IDCT_1D_avx2(rows, out);
+    const __m256i round_pass1 = _mm256_set1_epi32(1 << (CONST_BITS - PASS1_BITS - 1));
+    for (uint8_t r = 0; r < 8; r++) {
+        rows[r] = IDCT_packs_avx2(_mm256_srai_epi32(_mm256_add_epi32(out[r], round_pass1), CONST_BITS - PASS1_BITS));
     }
 
+    // Passe 2 : lignes (les colonnes de la transposée)
+    IDCT_transpose_avx2(rows);
+    islow_IDCT_1D_avx2(rows, out);
+
+    // range_limit[(x + 128) & RANGE_MASK] sans la table : ((x + 128 + 384) & RANGE_MASK) - 384 ramène les dépassements
+    // par le haut (256..639) au-dessus de 255 et ceux par le bas (640..1023) en dessous de 0, que packus sature ensuite
+    const __m256i round_pass2 = _mm256_set1_epi32(1 << (CONST_BITS + PASS1_BITS + 3 - 1));
+    const __m256i offset = _mm256_set1_epi32(128 + 384);
+    const __m256i mask = _mm256_set1_epi32(RANGE_MASK);
+    const __m256i unoffset = _mm256_set1_epi32(384);
+    for (uint8_t c = 0; c < 8; c++) {
+        __m256i x = _mm256_srai_epi32(_mm256_add_epi32(out[c], round_pass2), CONST_BITS + PASS1_BITS + 3);
+        x = _mm256_sub_epi32(_mm256_and_si256(_mm256_add_epi32(x, offset), mask), unoffset);
+        rows[c] = IDCT_packs_avx2(x);
+    }
+    IDCT_transpose_avx2(rows);
 
-    // passage en int
-    for (uint8_t i = 0; i<8; i++){
-        for (uint8_t j = 0; j<8; j++){
-            input_float[i][j] = round(8 * input_float[i][j] + 128) < 0 ? 0 : round(8 * input_float[i][j] + 128) > 255 ? 255 : round(8 * input_float[i][j] + 128);
-            (*input)[i * 8 + j] = (int16_t) input_float[i][j];
-        }
+    // Échantillons 8 bits (packus), deux lignes par registre, élargis sur 16 bits dans le bloc
+    for (uint8_t r = 0; r < 8; r += 2) {
+        __m128i pixels = _mm_packus_epi16(rows[r], rows[r + 1]);
+        _mm256_storeu_si256((__m256i *) (block + r * 8), _mm256_cvtepu8_epi16(pixels));
     }
 
     return EXIT_SUCCESS;
 }
 
+#endif
 
-// Fonction qui récupère les données de la structure JPEG et qui procède à l'IDCT inverse
-int8_t IDCT(struct JPEG * jpeg) {
 
-    // On parcours tous les MCUs de l'image
-    for (size_t y = 0; y < get_JPEG_nb_Mcu_Height(jpeg); y += get_JPEG_Sampling_Factor_Y(jpeg)) {
-        for (size_t x = 0; x < get_JPEG_nb_Mcu_Width(jpeg); x += get_JPEG_Sampling_Factor_X(jpeg)) {
-            for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
-                
-                // On récupère les MCUs de la composante
-                int16_t** MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i));
-                
-                for (int8_t v = 0; v < get_sampling_factor_y(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); v++) {
-                    for (int8_t h = 0; h < get_sampling_factor_x(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); h++) {
+// Meilleur noyau disponible sur le processeur qui exécute le décodeur (choisi à l'exécution, pas à la compilation)
+enum IDCTKernel get_IDCT_kernel() {
+#ifdef IDCT_X86
+    if (__builtin_cpu_supports("avx2")) return IDCT_KERNEL_AVX2;
+#endif
+    return IDCT_KERNEL_SCALAR;
+}
+
+const char * get_IDCT_kernel_name(enum IDCTKernel kernel) {
+    switch (kernel) {
+        case IDCT_KERNEL_AVX2: return "AVX2";
+        default: return "scalaire";
+    }
+}
+
+
+int8_t fast_IDCT_function_with_kernel(enum IDCTKernel kernel, int16_t **input, uint8_t last_nonzero){
+    switch (kernel) {
+#ifdef IDCT_X86
+        case IDCT_KERNEL_AVX2: return fast_IDCT_function_avx2(input, last_nonzero);
+#endif
+        default: return fast_IDCT_function_sparse(input, last_nonzero);
+    }
+}
+
+
+// IDCT de tous les blocs de l'image avec un noyau imposé (il doit être disponible sur le processeur, cf. get_IDCT_kernel())
+int8_t IDCT_with_kernel(struct JPEG * jpeg, enum IDCTKernel kernel) {
+
+    size_t nb_Mcu_Width_Strechted = get_JPEG_nb_Mcu_Width_Strechted(jpeg);
+    bool highly_verbose = getHighlyVerbose();
+
+    // Noyau choisi une seule fois pour toute l'image
+    int8_t (*IDCT_block)(int16_t **, uint8_t) = fast_IDCT_function_sparse;
+#ifdef IDCT_X86
+    if (kernel == IDCT_KERNEL_AVX2) IDCT_block = fast_IDCT_function_avx2;
+#endif
+
+    // On parcourt toutes les composantes : leurs tables et facteurs d'échantillonnage sont lus une seule fois
+    for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
+
+        // On récupère les MCUs de la composante
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        int16_t** MCUs = get_MCUs(component);
+        struct BlockInfo *blocks_info = get_blocks_info(component);
+        int8_t sampling_factor_x = get_sampling_factor_x(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i));
+        int8_t sampling_factor_y = get_sampling_factor_y(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i));
+
+        // On parcours tous les MCUs de l'image
+        for (size_t y = 0; y < get_JPEG_nb_Mcu_Height(jpeg); y += get_JPEG_Sampling_Factor_Y(jpeg)) {
+            for (size_t x = 0; x < get_JPEG_nb_Mcu_Width(jpeg); x += get_JPEG_Sampling_Factor_X(jpeg)) {
+                for (int8_t v = 0; v < sampling_factor_y; v++) {
+                    for (int8_t h = 0; h < sampling_factor_x; h++) {
                         // On récupère le MCU
-                        int16_t *mcu = MCUs[(y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h)];
+                        size_t index = (y + v) * nb_Mcu_Width_Strechted + (x + h);
+                        int16_t *mcu = MCUs[index];
 
-                        if (fast_IDCT_function(&mcu )) return EXIT_FAILURE;
-                        
-                        getHighlyVerbose() ? fprintf(stderr, "MCU après IDCT\n"):0;
-                        print_block(mcu, v * get_JPEG_Sampling_Factor_X(jpeg) + h, i);                    }
+                        if (IDCT_block(&mcu, blocks_info[index].last_nonzero)) return setDecoderError(DECODER_ERROR_GLOBAL);
+
+                        if (highly_verbose) {
+                            fprintf(stderr, "MCU après IDCT\n");
+                            print_block(mcu, index, i);
+                        }
+                    }
                 }
             }
         }
     }
     return EXIT_SUCCESS;
 }
+
+
+// Fonction qui récupère les données de la structure JPEG et qui procède à l'IDCT inverse (meilleur noyau disponible)
+int8_t IDCT(struct JPEG * jpeg) {
+    enum IDCTKernel kernel = get_IDCT_kernel();
+    getVerbose() ? printf("IDCT : noyau %s\n", get_IDCT_kernel_name(kernel)):0;
+    return IDCT_with_kernel(jpeg, kernel);
+}
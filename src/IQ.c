@@ -1,54 +1,143 @@
 #include <IQ.h>
 
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IQ_X86
+#endif
+
 
 // Inverse quantization function
 void IQ_function(int16_t *mcu, const uint8_t *qtable) {
-    for (int8_t k = 0; k < 64; k++) {
-        int32_t result = (int32_t)mcu[k] * qtable[k];
-        if (result > INT16_MAX)
-            mcu[k] = INT16_MAX;
-        else if (result < INT16_MIN)
-            mcu[k] = INT16_MIN;
-        else
-            mcu[k] = (int16_t)result;
+    struct BlockInfo block_info = {NB_VALUES_IN_8x8_BLOCK, NB_VALUES_IN_8x8_BLOCK - 1};
+    IQ_plane(mcu, &block_info, 1, qtable);
+}
+
+
+// Quantification inverse limitée aux coefficients d'indice (zigzag) <= last_nonzero : les suivants sont nuls
+void IQ_function_sparse(int16_t *mcu, const uint8_t *qtable, uint8_t last_nonzero) {
+    for (int8_t k = 0; k <= last_nonzero; k++) {
+        mcu[k] = dequantize_coefficient(mcu[k], qtable[k]);
+    }
+}
+
+
+//**********************************************************************************************************************
+// Noyaux de quantification inverse d'un plan de blocs contigus
+// Seuls les vecteurs qui contiennent des coefficients d'indice <= last_nonzero sont traités, les blocs vides sont sautés
+// Les versions vectorielles calculent le produit sur 32 bits (mullo/mulhi 16 bits entrelacés) puis le ramènent sur
+// 16 bits avec saturation (packs) : résultat identique à dequantize_coefficient()
+static void IQ_plane_scalar(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable) {
+    for (size_t j = 0; j < nb_blocks; j++) {
+        if (blocks_info[j].nb_nonzero == 0) continue;
+        IQ_function_sparse(blocks + j * NB_VALUES_IN_8x8_BLOCK, qtable, blocks_info[j].last_nonzero);
+    }
+}
+
+#ifdef IQ_X86
+__attribute__((target("sse2")))
+static void IQ_plane_sse2(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable) {
+    // Table convertie une seule fois en 16 bits pour tout le plan
+    __m128i quantization[8];
+    for (int8_t v = 0; v < 8; v++) {
+        quantization[v] = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (qtable + 8 * v)), _mm_setzero_si128());
+    }
+
+    for (size_t j = 0; j < nb_blocks; j++) {
+        if (blocks_info[j].nb_nonzero == 0) continue;
+        __m128i *block = (__m128i *) (blocks + j * NB_VALUES_IN_8x8_BLOCK);
+        for (int8_t v = 0; v <= blocks_info[j].last_nonzero / 8; v++) {
+            __m128i coefficients = _mm_loadu_si128(block + v);
+            __m128i low = _mm_mullo_epi16(coefficients, quantization[v]);
+            __m128i high = _mm_mulhi_epi16(coefficients, quantization[v]);
+            _mm_storeu_si128(block + v, _mm_packs_epi32(_mm_unpacklo_epi16(low, high), _mm_unpackhi_epi16(low, high)));
+        }
+    }
+}
+
+__attribute__((target("avx2")))
+static void IQ_plane_avx2(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable) {
+    __m256i quantization[4];
+    for (int8_t v = 0; v < 4; v++) {
+        quantization[v] = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (qtable + 16 * v)));
+    }
+
+    for (size_t j = 0; j < nb_blocks; j++) {
+        if (blocks_info[j].nb_nonzero == 0) continue;
+        __m256i *block = (__m256i *) (blocks + j * NB_VALUES_IN_8x8_BLOCK);
+        for (int8_t v = 0; v <= blocks_info[j].last_nonzero / 16; v++) {
+            __m256i coefficients = _mm256_loadu_si256(block + v);
+            __m256i low = _mm256_mullo_epi16(coefficients, quantization[v]);
+            __m256i high = _mm256_mulhi_epi16(coefficients, quantization[v]);
+            // unpack et packs travaillent dans chaque moitié de 128 bits : l'ordre des coefficients est conservé
+            _mm256_storeu_si256(block + v, _mm256_packs_epi32(_mm256_unpacklo_epi16(low, high), _mm256_unpackhi_epi16(low, high)));
+        }
+    }
+}
+#endif
+
+
+// Meilleur noyau disponible sur le processeur qui exécute le décodeur (choisi à l'exécution, pas à la compilation)
+enum IQKernel get_IQ_kernel() {
+#ifdef IQ_X86
+    if (__builtin_cpu_supports("avx2")) return IQ_KERNEL_AVX2;
+    if (__builtin_cpu_supports("sse2")) return IQ_KERNEL_SSE2;
+#endif
+    return IQ_KERNEL_SCALAR;
+}
+
+const char * get_IQ_kernel_name(enum IQKernel kernel) {
+    switch (kernel) {
+        case IQ_KERNEL_AVX2: return "AVX2";
+        case IQ_KERNEL_SSE2: return "SSE2";
+        default: return "scalaire";
     }
 }
 
 
+void IQ_plane_with_kernel(enum IQKernel kernel, int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable) {
+    switch (kernel) {
+#ifdef IQ_X86
+        case IQ_KERNEL_AVX2: IQ_plane_avx2(blocks, blocks_info, nb_blocks, qtable); break;
+        case IQ_KERNEL_SSE2: IQ_plane_sse2(blocks, blocks_info, nb_blocks, qtable); break;
+#endif
+        default: IQ_plane_scalar(blocks, blocks_info, nb_blocks, qtable); break;
+    }
+}
+
+
+void IQ_plane(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks, const uint8_t *qtable) {
+    IQ_plane_with_kernel(get_IQ_kernel(), blocks, blocks_info, nb_blocks, qtable);
+}
+
+
 // Fonction qui récupère les données de la structure JPEG et qui procède à la quantification inverse
 int8_t IQ(struct JPEG * jpeg) {
 
-    // On parcourt tous les MCUs de l'image
-    for (size_t y = 0; y < get_JPEG_nb_Mcu_Height(jpeg); y += get_JPEG_Sampling_Factor_Y(jpeg)) {
-        for (size_t x = 0; x < get_JPEG_nb_Mcu_Width(jpeg); x += get_JPEG_Sampling_Factor_X(jpeg)) {
-
-            // On parcourt toutes les composantes
-            for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
-                
-                // On récupère la table de quantification associée à la composante
-                int8_t qt_index = get_num_quantization_table(get_sof_component(get_sof_components((get_JPEG_sof(jpeg)[0]) ), i));
-                getHighlyVerbose() ? fprintf(stderr, "qt_index : %d\n", qt_index):0;
-                struct QuantizationTable *qt = get_JPEG_qt(jpeg)[qt_index];
-                const uint8_t *qt_table = get_qt_data(qt);
-                
-                // On récupère les MCUs de la composante
-                int16_t** MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i));
-
-                for (int8_t v = 0; v < get_sampling_factor_y(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); v++) {
-                    for (int8_t h = 0; h < get_sampling_factor_x(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); h++) {
-                        // On récupère le MCU
-                        int16_t *mcu = MCUs[(y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h)];
-
-                        getHighlyVerbose() ? fprintf(stderr, "MCU avant IQ\n"):0;
-                        print_block(mcu,(y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h) , i);
-
-                        // On applique la quantification inverse
-                        IQ_function(mcu, qt_table);
-
-                        getHighlyVerbose() ? fprintf(stderr, "MCU après IQ\n"):0;
-                        print_block(mcu, v * get_JPEG_Sampling_Factor_X(jpeg) + h, i);
-                    }
-                }
+    // Image séquentielle : decode_MCU() a déjà multiplié chaque coefficient par sa table
+    if (get_JPEG_dequantized(jpeg)) return EXIT_SUCCESS;
+
+    // Les blocs d'une composante sont contigus et partagent la même table : un seul appel par composante
+    // (les blocs hors de la grille des MCUs sont nuls, cf. get_progressive_SOS(), et sont sautés)
+    size_t nb_blocks = get_JPEG_nb_Mcu_Width_Strechted(jpeg) * get_JPEG_nb_Mcu_Height_Strechted(jpeg);
+    enum IQKernel kernel = get_IQ_kernel();
+    getVerbose() ? printf("Quantification inverse : noyau %s\n", get_IQ_kernel_name(kernel)):0;
+
+    // On parcourt toutes les composantes
+    for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
+
+        // On récupère la table de quantification associée à la composante
+        int8_t qt_index = get_num_quantization_table(get_sof_component(get_sof_components((get_JPEG_sof(jpeg)[0]) ), i));
+        getHighlyVerbose() ? fprintf(stderr, "qt_index : %d\n", qt_index):0;
+        const uint8_t *qt_table = get_qt_data(get_JPEG_qt(jpeg)[qt_index]);
+
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        IQ_plane_with_kernel(kernel, get_coefficients(component), get_blocks_info(component), nb_blocks, qt_table);
+
+        if (getHighlyVerbose()) {
+            int16_t **MCUs = get_MCUs(component);
+            for (size_t j = 0; j < nb_blocks; j++) {
+                fprintf(stderr, "MCU après IQ\n");
+                print_block(MCUs[j], j, i);
             }
         }
     }
@@ -1,53 +1,179 @@
 #include <IZZ.h>
 
-const uint8_t zigzag_table[]={
-    0, 1, 8, 16, 9, 2, 3, 10,
-    17, 24, 32, 25, 18, 11, 4, 5,
-    12, 19, 26, 33, 40, 48, 41, 34,
-    27, 20, 13, 6, 7, 14, 21, 28,
-    35, 42, 49, 56, 57, 50, 43, 36,
-    29, 22, 15, 23, 30, 37, 44, 51,
-    58, 59, 52, 45, 38, 31, 39, 46,
-    53, 60, 61, 54, 47, 55, 62, 63
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define IZZ_X86
+#endif
+
+#ifdef IZZ_X86
+
+// Dé-zigzag par pshufb : la ligne r (ordre naturel) du bloc est un OU des octets pris dans quelques-unes des 8 lignes
+// (ordre zigzag) chargées dans des registres. Pour chaque ligne r, IZZ_SHUFFLES[IZZ_ROWS[r]..IZZ_ROWS[r+1]] donne la
+// ligne source et le masque de pshufb (-1 : octet mis à zéro), déduits de zigzag_table
+struct IZZShuffle {
+    uint8_t source;
+    int8_t mask[16];
+};
+
+static const uint8_t IZZ_ROWS[9] = {0, 3, 8, 13, 18, 23, 28, 33, 36};
+
+static const struct IZZShuffle IZZ_SHUFFLES[36] = {
+    {0, { 0,  1,  2,  3, 10, 11, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 0
+    {1, {-1, -1, -1, -1, -1, -1, -1, -1, 12, 13, 14, 15, -1, -1, -1, -1}},   // ligne 0
+    {3, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  6,  7,  8,  9}},   // ligne 0
+    {0, { 4,  5,  8,  9, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 1
+    {1, {-1, -1, -1, -1, -1, -1, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 1
+    {2, {-1, -1, -1, -1, -1, -1, -1, -1,  0,  1, -1, -1, -1, -1, -1, -1}},   // ligne 1
+    {3, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  4,  5, 10, 11, -1, -1}},   // ligne 1
+    {5, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  4,  5}},   // ligne 1
+    {0, { 6,  7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 2
+    {1, {-1, -1,  0,  1,  8,  9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 2
+    {2, {-1, -1, -1, -1, -1, -1,  2,  3, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 2
+    {3, {-1, -1, -1, -1, -1, -1, -1, -1,  2,  3, 12, 13, -1, -1, -1, -1}},   // ligne 2
+    {5, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  2,  3,  6,  7}},   // ligne 2
+    {1, { 2,  3,  6,  7, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 3
+    {2, {-1, -1, -1, -1,  4,  5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 3
+    {3, {-1, -1, -1, -1, -1, -1,  0,  1, 14, 15, -1, -1, -1, -1, -1, -1}},   // ligne 3
+    {5, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  1,  8,  9, -1, -1}},   // ligne 3
+    {6, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11}},   // ligne 3
+    {1, { 4,  5, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 4
+    {2, {-1, -1,  6,  7, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 4
+    {4, {-1, -1, -1, -1, -1, -1,  0,  1, 14, 15, -1, -1, -1, -1, -1, -1}},   // ligne 4
+    {5, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 10, 11, -1, -1, -1, -1}},   // ligne 4
+    {6, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  8,  9, 12, 13}},   // ligne 4
+    {2, { 8,  9, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 5
+    {4, {-1, -1, -1, -1,  2,  3, 12, 13, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 5
+    {5, {-1, -1, -1, -1, -1, -1, -1, -1, 12, 13, -1, -1, -1, -1, -1, -1}},   // ligne 5
+    {6, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  6,  7, 14, 15, -1, -1}},   // ligne 5
+    {7, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  8,  9}},   // ligne 5
+    {2, {10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 6
+    {4, {-1, -1,  4,  5, 10, 11, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 6
+    {5, {-1, -1, -1, -1, -1, -1, 14, 15, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 6
+    {6, {-1, -1, -1, -1, -1, -1, -1, -1,  4,  5, -1, -1, -1, -1, -1, -1}},   // ligne 6
+    {7, {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1,  0,  1,  6,  7, 10, 11}},   // ligne 6
+    {4, { 6,  7,  8,  9, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 7
+    {6, {-1, -1, -1, -1,  0,  1,  2,  3, -1, -1, -1, -1, -1, -1, -1, -1}},   // ligne 7
+    {7, {-1, -1, -1, -1, -1, -1, -1, -1,  2,  3,  4,  5, 12, 13, 14, 15}},   // ligne 7
 };
 
+// Dé-zigzague un bloc complet en registres : les 8 lignes sont chargées avant d'écrire, le bloc peut donc être modifié en place
+__attribute__((target("ssse3")))
+static inline void IZZ_block_ssse3(int16_t *mcu){
+    __m128i zigzag[8];
+    for (int8_t s = 0; s < 8; s++) {
+        zigzag[s] = _mm_loadu_si128((const __m128i *) (mcu + 8 * s));
+    }
+    // Boucles déroulées : les lignes sources et les masques deviennent des constantes
+    #pragma GCC unroll 8
+    for (int8_t r = 0; r < 8; r++) {
+        __m128i row = _mm_setzero_si128();
+        #pragma GCC unroll 8
+        for (uint8_t e = IZZ_ROWS[r]; e < IZZ_ROWS[r + 1]; e++) {
+            row = _mm_or_si128(row, _mm_shuffle_epi8(zigzag[IZZ_SHUFFLES[e].source], _mm_loadu_si128((const __m128i *) IZZ_SHUFFLES[e].mask)));
+        }
+        _mm_storeu_si128((__m128i *) (mcu + 8 * r), row);
+    }
+}
+#endif
+
 
 // Fonction qui permet de dé-zigzaguer un bloc
-int8_t IZZ_function(int16_t **mcu){
-    
-    int16_t *block = (int16_t *) malloc(64 * sizeof(int16_t));
-    if (check_memory_allocation(block)) return EXIT_FAILURE;
+void IZZ_function(int16_t *mcu){
+    struct BlockInfo block_info = {NB_VALUES_IN_8x8_BLOCK, NB_VALUES_IN_8x8_BLOCK - 1};
+    IZZ_plane(mcu, &block_info, 1);
+}
+
+
+// Dé-zigzague un bloc (en place) dont les coefficients d'indice (zigzag) > last_nonzero sont nuls
+// Les coefficients utiles sont mis de côté avant de remettre le bloc à zéro et de les replacer
+void IZZ_function_sparse(int16_t *mcu, uint8_t last_nonzero){
 
-    
-    for (int8_t i = 0; i < 64; i++) {
-        block[zigzag_table[i]] = (*mcu)[i];    
+    int16_t zigzag[64];
+    memcpy(zigzag, mcu, (last_nonzero + 1) * sizeof(int16_t));
+    memset(mcu, 0, 64 * sizeof(int16_t));
+
+    for (int8_t i = 0; i <= last_nonzero; i++) {
+        mcu[zigzag_table[i]] = zigzag[i];
     }
+}
 
-    free(*mcu);
-    *mcu = block;
 
-    return EXIT_SUCCESS;
+//**********************************************************************************************************************
+// Noyaux de dé-zigzag d'un plan de blocs contigus (64 coefficients chacun), par exemple tous ceux d'une composante
+// Un bloc réduit au DC n'a pas besoin d'être déplacé (la permutation en registres est plus rapide que la version
+// scalaire même pour un bloc presque vide)
+static void IZZ_plane_scalar(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks){
+    for (size_t j = 0; j < nb_blocks; j++) {
+        uint8_t last_nonzero = blocks_info[j].last_nonzero;
+        if (last_nonzero == 0) continue;
+        IZZ_function_sparse(blocks + j * NB_VALUES_IN_8x8_BLOCK, last_nonzero);
+    }
+}
+
+#ifdef IZZ_X86
+__attribute__((target("ssse3")))
+static void IZZ_plane_ssse3(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks){
+    for (size_t j = 0; j < nb_blocks; j++) {
+        if (blocks_info[j].last_nonzero == 0) continue;
+        IZZ_block_ssse3(blocks + j * NB_VALUES_IN_8x8_BLOCK);
+    }
+}
+#endif
+
+
+// Meilleur noyau disponible sur le processeur qui exécute le décodeur (choisi à l'exécution, pas à la compilation)
+enum IZZKernel get_IZZ_kernel() {
+#ifdef IZZ_X86
+    if (__builtin_cpu_supports("ssse3")) return IZZ_KERNEL_SSSE3;
+#endif
+    return IZZ_KERNEL_SCALAR;
+}
+
+const char * get_IZZ_kernel_name(enum IZZKernel kernel) {
+    switch (kernel) {
+        case IZZ_KERNEL_SSSE3: return "SSSE3";
+        default: return "scalaire";
+    }
+}
+
+
+void IZZ_plane_with_kernel(enum IZZKernel kernel, int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks){
+    switch (kernel) {
+#ifdef IZZ_X86
+        case IZZ_KERNEL_SSSE3: IZZ_plane_ssse3(blocks, blocks_info, nb_blocks); break;
+#endif
+        default: IZZ_plane_scalar(blocks, blocks_info, nb_blocks); break;
+    }
+}
+
+
+void IZZ_plane(int16_t *blocks, const struct BlockInfo *blocks_info, size_t nb_blocks){
+    IZZ_plane_with_kernel(get_IZZ_kernel(), blocks, blocks_info, nb_blocks);
 }
 
 
 int8_t IZZ(struct JPEG * jpeg) {
-    size_t nb_mcu_width = (get_JPEG_width(jpeg) + 7) / 8;
-    size_t nb_mcu_height = (get_JPEG_height(jpeg) + 7) / 8;
 
-    // On parcourt toutes les composantes
+    // Image séquentielle : decode_MCU() a déjà rangé chaque coefficient à sa place dans l'ordre naturel
+    if (get_JPEG_dequantized(jpeg)) return EXIT_SUCCESS;
+
+    // Tous les blocs de la grille (complétée selon les facteurs d'échantillonnage) : les derniers sont aussi affichés
+    size_t nb_blocks = get_JPEG_nb_Mcu_Width_Strechted(jpeg) * get_JPEG_nb_Mcu_Height_Strechted(jpeg);
+    enum IZZKernel kernel = get_IZZ_kernel();
+    getVerbose() ? printf("Dé-zigzag : noyau %s\n", get_IZZ_kernel_name(kernel)):0;
+
+    // On parcourt toutes les composantes : leurs blocs sont contigus, un seul appel par composante
     for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
-        
-        int16_t **MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i));
-        
-        // On parcourt tous les MCUs de l'image
-        for (size_t j = 0; j < nb_mcu_width * nb_mcu_height; j++){
-            // Prévoir possibilité de reset-er les données `previous_DC_values` dans le cas où l'on a
-            // plusieurs scans/frames ---> mode progressif
-            
-            if (IZZ_function(&(MCUs[j])) ) return EXIT_FAILURE;
-
-            getHighlyVerbose() ? fprintf(stderr, "MCU après IZZ\n"):0;
-            print_block(MCUs[j], j, i);
+
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        IZZ_plane_with_kernel(kernel, get_coefficients(component), get_blocks_info(component), nb_blocks);
+
+        if (getHighlyVerbose()) {
+            int16_t **MCUs = get_MCUs(component);
+            for (size_t j = 0; j < nb_blocks; j++){
+                fprintf(stderr, "MCU après IZZ\n");
+                print_block(MCUs[j], j, i);
+            }
         }
     }
     return EXIT_SUCCESS;
@@ -0,0 +1,89 @@
+#include <bitreader.h>
+
+
+// Initialise le lecteur sur size octets de données
+void initialize_bit_reader(struct BitReader *reader, const unsigned char *data, size_t size) {
+    reader->start = data;
+    reader->ptr = data;
+    reader->end = data + size;
+    reader->last_stuffing = NULL;
+    reader->buffer = 0;
+    reader->nb_bits = 0;
+    reader->nb_virtual_bytes = 0;
+    bit_reader_refill(reader);
+}
+
+
+// Recharge le réservoir octet par octet en retirant le byte stuffing
+// Une fois la fin des données ou un marker atteint, on complète avec des 0 (la fin des données est vérifiée par
+// l'appelant via la position)
+void bit_reader_refill_bytes(struct BitReader *reader) {
+    while (reader->nb_bits < BIT_READER_MIN_BITS) {
+        uint64_t byte = 0;
+        const unsigned char *ptr = reader->ptr;
+        if (ptr < reader->end && (ptr[0] != 0xFF || (ptr + 1 < reader->end && ptr[1] == 0x00))) {
+            byte = ptr[0];
+            if (byte == 0xFF) {     // 0xFF 0x00 : on saute l'octet de stuffing
+                reader->last_stuffing = ptr + 1;
+                reader->ptr += 2;
+            } else {
+                reader->ptr++;
+            }
+        } else {
+            reader->nb_virtual_bytes++;
+        }
+        reader->buffer |= byte << (56 - reader->nb_bits);
+        reader->nb_bits += 8;
+    }
+}
+
+
+// Position courante du lecteur (en bits depuis le début des données)
+size_t get_bit_reader_position(const struct BitReader *reader) {
+    size_t position = 8 * ((size_t) (reader->ptr - reader->start) + reader->nb_virtual_bytes) - reader->nb_bits;
+
+    // Aucun octet de stuffing parmi les derniers octets chargés : la position se déduit directement de ptr
+    if (reader->last_stuffing == NULL || reader->ptr - reader->last_stuffing > 8) return position;
+
+    // Sinon on remonte les octets chargés dont des bits restent dans le réservoir,
+    // les octets de stuffing qui s'y trouvent sont déjà passés dans le fichier mais pas encore dans les bits lus
+    size_t virtual_bits = 8 * reader->nb_virtual_bytes;
+    size_t remaining_bits = (reader->nb_bits > virtual_bits) ? reader->nb_bits - virtual_bits : 0;
+    const unsigned char *ptr = reader->ptr;
+    size_t nb_bits = 0;
+    while (nb_bits < remaining_bits) {
+        ptr--;
+        if (ptr[0] == 0x00 && ptr > reader->start && ptr[-1] == 0xFF) {
+            position -= 8;
+        } else {
+            nb_bits += 8;
+        }
+    }
+    return position;
+}
+
+
+// Replace le lecteur à la position bit_position (en bits depuis le début des données)
+void bit_reader_seek(struct BitReader *reader, size_t bit_position) {
+    reader->ptr = reader->start + bit_position / 8;
+    reader->last_stuffing = NULL;
+    reader->buffer = 0;
+    reader->nb_bits = 0;
+    reader->nb_virtual_bytes = 0;
+    if (reader->ptr > reader->end) {    // au-delà des données : on ne lit plus que des octets nuls "virtuels"
+        reader->nb_virtual_bytes = reader->ptr - reader->end;
+        reader->ptr = reader->end;
+    } else if (reader->ptr > reader->start && reader->ptr < reader->end && reader->ptr[0] == 0x00 && reader->ptr[-1] == 0xFF) {
+        reader->last_stuffing = reader->ptr;    // on ne commence pas sur un octet de stuffing
+        reader->ptr++;
+    }
+    bit_reader_refill(reader);
+    bit_reader_consume(reader, bit_position % 8);
+}
+
+
+// Indique si le lecteur a consommé plus de bits que les données n'en contiennent
+bool bit_reader_overrun(const struct BitReader *reader) {
+    if (reader->nb_virtual_bytes == 0) return false;
+    return get_bit_reader_position(reader) > 8 * (size_t) (reader->end - reader->start);
+}
@@ -0,0 +1,217 @@
+#include <decode.h>
+
+
+int8_t decode_JPEG_YCbCr(struct JPEG *jpeg, bool speculative) {
+
+    int8_t status;
+
+    // Image progressive : les scans sont décodés les uns après les autres (pas de décodage spéculatif)
+    if (get_JPEG_progressive(jpeg)) {
+        status = decode_progressive(jpeg);
+    } else {
+        status = speculative ? decode_bitstream_speculative(jpeg) : decode_bitstream(jpeg);
+    }
+    if (status) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG_YCbCr() > decode_bitstream() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    if ((status = IQ(jpeg))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG_YCbCr() > IQ() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    if ((status = IZZ(jpeg))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG_YCbCr() > IZZ() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    if ((status = IDCT(jpeg))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG_YCbCr() > IDCT() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    if (get_JPEG_Sampling_Factor_X(jpeg) != 1 || get_JPEG_Sampling_Factor_Y(jpeg) != 1) {
+        stretch_function(jpeg);
+    }
+
+    return DECODER_OK;
+}
+
+
+int8_t decode_JPEG(struct JPEG *jpeg, bool speculative, bool force_grayscale) {
+
+    int8_t status;
+
+    if ((status = decode_JPEG_YCbCr(jpeg, speculative))) return status;
+
+    if ((status = YCbCr2RGB(jpeg, force_grayscale))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG() > YCbCr2RGB() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    return DECODER_OK;
+}
+
+
+int8_t decode_JPEG_DC_preview(struct JPEG *jpeg, bool speculative) {
+
+    if (get_JPEG_preview_callback(jpeg).function == NULL) {
+        fprintf(stderr, RED("ERROR : ARGUMENT - decode.c > decode_JPEG_DC_preview() | no preview callback\n"));
+        return setDecoderError(DECODER_ERROR_ARGUMENT);
+    }
+
+    int8_t status;
+
+    // Image progressive : l'aperçu est calculé dès que les coefficients DC de toutes les composantes sont connus
+    if (get_JPEG_progressive(jpeg)) {
+        status = decode_progressive(jpeg);
+    } else {
+        status = speculative ? decode_bitstream_speculative(jpeg) : decode_bitstream(jpeg);
+        if (status == DECODER_OK) status = emit_DC_preview(jpeg);
+    }
+    if (status) {
+        fprintf(stderr, RED("ERROR : GLOBAL - decode.c > decode_JPEG_DC_preview() > decode_bitstream() | %s\n"), getDecoderStatusName(status));
+        return status;
+    }
+
+    return DECODER_OK;
+}
+
+
+int8_t jpeg_decode_mem(const uint8_t *buf, size_t len, uint8_t *pixels, size_t pixels_size, size_t stride,
+                       enum PixelFormat format, uint16_t *width, uint16_t *height) {
+
+    uint8_t pixel_size = get_pixel_format_size(format);
+    if (buf == NULL || pixel_size == 0) {
+        fprintf(stderr, RED("ERROR : ARGUMENT - decode.c > jpeg_decode_mem() | invalid buffer or pixel format\n"));
+        resetDecoderStatus();
+        return setDecoderError(DECODER_ERROR_ARGUMENT);
+    }
+
+    struct JPEG *jpeg = extract_mem(buf, len);
+    if (jpeg == NULL) return getDecoderStatus();
+
+    size_t image_width = get_JPEG_width(jpeg);
+    size_t image_height = get_JPEG_height(jpeg);
+    if (width != NULL) *width = image_width;
+    if (height != NULL) *height = image_height;
+
+    // Seules les dimensions sont demandées
+    if (pixels == NULL) {
+        free_JPEG_struct(jpeg);
+        return DECODER_OK;
+    }
+
+    // Le buffer de l'appelant doit contenir toutes les lignes (la dernière n'a pas besoin d'être complétée jusqu'à stride)
+    // Une image de hauteur nulle (cf. get_SOF()) n'a aucune ligne : stride * (0 - 1) déborderait
+    size_t line_size = image_width * pixel_size;
+    size_t needed_size = (image_height == 0) ? 0 : stride * (image_height - 1) + line_size;
+    if (stride < line_size || pixels_size < needed_size) {
+        fprintf(stderr, RED("ERROR : ARGUMENT - decode.c > jpeg_decode_mem() | output buffer too small for %zux%zu pixels\n"), image_width, image_height);
+        free_JPEG_struct(jpeg);
+        return setDecoderError(DECODER_ERROR_ARGUMENT);
+    }
+
+    // En niveaux de gris, on garde la luminance plutôt que de calculer R, G et B
+    bool force_grayscale = (format == PIXEL_FORMAT_GRAY8);
+
+    int8_t status = decode_JPEG(jpeg, false, force_grayscale);
+    if (status == DECODER_OK) {
+        write_pixels(jpeg, pixels, stride, format, force_grayscale);
+    }
+
+    free_JPEG_struct(jpeg);
+    return status;
+}
+
+
+//**********************************************************************************************************************
+// Décodeur réutilisable
+struct JPEGDecoder {
+    struct JPEG *jpeg;      // image précédente, dont la structure sert à la suivante (NULL au départ ou après une erreur)
+    uint8_t *pixels;        // pixels de la dernière image (cf. JPEG_decoder_pixels())
+    size_t pixels_size;     // taille allouée de pixels
+};
+
+struct JPEGDecoder * create_JPEG_decoder() {
+    struct JPEGDecoder *decoder = (struct JPEGDecoder *) malloc(sizeof(struct JPEGDecoder));
+    if (check_memory_allocation((void *) decoder)) {
+        setDecoderError(DECODER_ERROR_MEMORY);
+        return NULL;
+    }
+    decoder->jpeg = NULL;
+    decoder->pixels = NULL;
+    decoder->pixels_size = 0;
+    return decoder;
+}
+
+
+struct JPEG * JPEG_decoder_extract(struct JPEGDecoder *decoder, char *filename) {
+    // En cas d'erreur, la structure est libérée : la suivante sera allouée à nouveau
+    decoder->jpeg = extract_into(decoder->jpeg, filename);
+    return decoder->jpeg;
+}
+
+
+struct JPEG * JPEG_decoder_extract_mem(struct JPEGDecoder *decoder, const uint8_t *buf, size_t len) {
+    decoder->jpeg = extract_mem_into(decoder->jpeg, buf, len);
+    return decoder->jpeg;
+}
+
+
+const uint8_t * JPEG_decoder_pixels(struct JPEGDecoder *decoder, enum PixelFormat format, bool force_grayscale) {
+    size_t stride = get_JPEG_width(decoder->jpeg) * get_pixel_format_size(format);
+    size_t size = stride * get_JPEG_height(decoder->jpeg);
+
+    if (size > decoder->pixels_size) {
+        uint8_t *pixels = (uint8_t *) realloc(decoder->pixels, size);
+        if (check_memory_allocation((void *) pixels)) {
+            setDecoderError(DECODER_ERROR_MEMORY);
+            return NULL;
+        }
+        decoder->pixels = pixels;
+        decoder->pixels_size = size;
+    }
+    write_pixels(decoder->jpeg, decoder->pixels, stride, format, force_grayscale);
+    return decoder->pixels;
+}
+
+
+int8_t JPEG_decoder_decode_mem(struct JPEGDecoder *decoder, const uint8_t *buf, size_t len, enum PixelFormat format,
+                               const uint8_t **pixels, uint16_t *width, uint16_t *height) {
+
+    if (buf == NULL || pixels == NULL || get_pixel_format_size(format) == 0) {
+        fprintf(stderr, RED("ERROR : ARGUMENT - decode.c > JPEG_decoder_decode_mem() | invalid buffer or pixel format\n"));
+        resetDecoderStatus();
+        return setDecoderError(DECODER_ERROR_ARGUMENT);
+    }
+
+    struct JPEG *jpeg = JPEG_decoder_extract_mem(decoder, buf, len);
+    if (jpeg == NULL) return getDecoderStatus();
+
+    if (width != NULL) *width = get_JPEG_width(jpeg);
+    if (height != NULL) *height = get_JPEG_height(jpeg);
+
+    // En niveaux de gris, on garde la luminance plutôt que de calculer R, G et B
+    bool force_grayscale = (format == PIXEL_FORMAT_GRAY8);
+
+    int8_t status = decode_JPEG(jpeg, false, force_grayscale);
+    if (status) return status;
+
+    *pixels = JPEG_decoder_pixels(decoder, format, force_grayscale);
+    return (*pixels == NULL) ? getDecoderStatus() : DECODER_OK;
+}
+
+
+void reset_JPEG_decoder(struct JPEGDecoder *decoder) {
+    if (decoder->jpeg != NULL) reset_JPEG_struct(decoder->jpeg, false);
+}
+
+
+void free_JPEG_decoder(struct JPEGDecoder *decoder) {
+    if (decoder == NULL) return;
+    free_JPEG_struct(decoder->jpeg);
+    free(decoder->pixels);
+    free(decoder);
+}
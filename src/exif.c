@@ -0,0 +1,90 @@
+#include <exif.h>
+
+
+// Entiers de 16 et 32 bits de l'en-tête TIFF, dans l'ordre des octets du fichier ("II" : little endian, "MM" : big endian)
+static uint16_t read_16_bits(const unsigned char *data, bool little_endian) {
+    return little_endian ? (uint16_t) (data[0] | (data[1] << 8)) : (uint16_t) ((data[0] << 8) | data[1]);
+}
+
+static uint32_t read_32_bits(const unsigned char *data, bool little_endian) {
+    return little_endian ? ((uint32_t) read_16_bits(data + 2, true) << 16) | read_16_bits(data, true)
+                         : ((uint32_t) read_16_bits(data, false) << 16) | read_16_bits(data + 2, false);
+}
+
+
+// Recherche la vignette dans la structure TIFF (tiff_size octets) d'un segment Exif
+static bool find_tiff_thumbnail(const unsigned char *tiff, size_t tiff_size, const unsigned char **thumbnail, size_t *thumbnail_size) {
+    if (tiff_size < TIFF_HEADER_SIZE) return false;
+
+    bool little_endian;
+    if (tiff[0] == 'I' && tiff[1] == 'I') {
+        little_endian = true;
+    } else if (tiff[0] == 'M' && tiff[1] == 'M') {
+        little_endian = false;
+    } else {
+        return false;
+    }
+    if (read_16_bits(tiff + 2, little_endian) != TIFF_MAGIC_NUMBER) return false;
+
+    // IFD0 (image principale) : on ne lit que la position de l'IFD suivant, l'IFD1 (vignette)
+    size_t ifd = read_32_bits(tiff + 4, little_endian);
+    if (ifd > tiff_size - 2) return false;
+    size_t nb_entries = read_16_bits(tiff + ifd, little_endian);
+    if (nb_entries * IFD_ENTRY_SIZE + 4 > tiff_size - ifd - 2) return false;
+    ifd = read_32_bits(tiff + ifd + 2 + nb_entries * IFD_ENTRY_SIZE, little_endian);
+    if (ifd == 0 || ifd > tiff_size - 2) return false;
+
+    nb_entries = read_16_bits(tiff + ifd, little_endian);
+    if (nb_entries * IFD_ENTRY_SIZE > tiff_size - ifd - 2) return false;
+
+    size_t offset = 0;
+    size_t length = 0;
+    for (size_t i = 0; i < nb_entries; i++) {
+        const unsigned char *entry = tiff + ifd + 2 + i * IFD_ENTRY_SIZE;
+        uint16_t tag = read_16_bits(entry, little_endian);
+        uint16_t type = read_16_bits(entry + 2, little_endian);
+        size_t value = (type == IFD_TYPE_SHORT) ? read_16_bits(entry + 8, little_endian) : read_32_bits(entry + 8, little_endian);
+
+        if (tag == EXIF_TAG_THUMBNAIL_OFFSET) offset = value;
+        if (tag == EXIF_TAG_THUMBNAIL_LENGTH) length = value;
+    }
+
+    // La vignette doit être entièrement dans le segment et commencer par le marker SOI
+    if (offset == 0 || length < 4 || offset > tiff_size || length > tiff_size - offset) return false;
+    if (tiff[offset] != SEGMENT_START || tiff[offset + 1] != SOI) return false;
+
+    *thumbnail = tiff + offset;
+    *thumbnail_size = length;
+    return true;
+}
+
+
+bool find_exif_thumbnail(const unsigned char *data, size_t size, const unsigned char **thumbnail, size_t *thumbnail_size) {
+    const unsigned char Exif[EXIF_IDENTIFIER_LENGTH] = {0x45, 0x78, 0x69, 0x66, 0x00, 0x00};
+
+    if (size < 4 || data[0] != SEGMENT_START || data[1] != SOI) return false;
+
+    // Segments de l'en-tête, de marker en marker (longueur sur 2 octets, comprise dans le segment)
+    size_t position = 2;
+    while (position + 4 <= size && data[position] == SEGMENT_START) {
+        unsigned char marker = data[position + 1];
+        if (marker == SEGMENT_START) {    // octet de remplissage
+            position++;
+            continue;
+        }
+        if (marker == SOS || marker == EOI || marker == SOF_0 || marker == SOF_2) break;
+
+        size_t length = (data[position + 2] << 8) | data[position + 3];
+        if (length < 2 || length > size - position - 2) break;
+
+        const unsigned char *segment = data + position + 4;
+        size_t segment_size = length - 2;
+        if (marker == APP1 && segment_size > EXIF_IDENTIFIER_LENGTH && memcmp(segment, Exif, EXIF_IDENTIFIER_LENGTH) == 0) {
+            bool found = find_tiff_thumbnail(segment + EXIF_IDENTIFIER_LENGTH, segment_size - EXIF_IDENTIFIER_LENGTH, thumbnail, thumbnail_size);
+            getVerbose() ? printf("Segment Exif de %zu octets : %s\n", length, found ? "vignette JPEG trouvée" : "pas de vignette JPEG"):0;
+            return found;
+        }
+        position += 2 + length;
+    }
+    return false;
+}
@@ -1,4 +1,6 @@
+#define _POSIX_C_SOURCE 200809L    // posix_memalign()
 #include <extract.h>
+#include <standard_huffman_tables.h>    // généré à la compilation (cf. tools/generate_standard_tables.c)
 
 //**********************************************************************************************************************
 // Quantization tables
@@ -6,18 +8,32 @@ struct QuantizationTable{
     int8_t id;
     size_t length;
     uint8_t *data;
+    uint16_t dequantization[NB_VALUES_IN_8x8_BLOCK];   // data dans l'ordre naturel (coefficients après IZZ)
     bool set;
+    bool shared;    // table du cache partagé (cf. table_cache.h) : ni modifiée, ni libérée
 };
 
 int8_t initialize_qt(struct QuantizationTable *qt, int8_t id, size_t length, unsigned char *data, bool set){
     qt->id = id;
     qt->length = length;
     qt->data = data;
+    memset(qt->dequantization, 0, sizeof(qt->dequantization));
     qt->set = set;
+    qt->shared = false;
 
     return EXIT_SUCCESS;
 }
 
+// Table non définie, mise à la place des tables d'une structure réutilisée (cf. reset_JPEG_struct()) : sans allocation
+static const struct QuantizationTable unset_quantization_table = {.id = -1, .set = false, .shared = true};
+
+// Libère une table de quantification (et son contenu), sauf si elle est dans le cache partagé
+static void free_quantization_table(struct QuantizationTable *qt){
+    if (qt == NULL || qt->shared) return;
+    free(qt->data);
+    free(qt);
+}
+
 int8_t get_qt_id(struct QuantizationTable *qt){
     return qt->id;
 }
@@ -30,6 +46,10 @@ uint8_t * get_qt_data(struct QuantizationTable *qt){
     return qt->data;
 }
 
+const uint16_t * get_qt_dequantization(struct QuantizationTable *qt){
+    return qt->dequantization;
+}
+
 bool get_qt_set(struct QuantizationTable *qt){
     return qt->set;
 }
@@ -80,8 +100,8 @@ int8_t initialize_sof(struct StartOfFrame *sof, int8_t nb_components, int8_t id,
     if (nb_components == 0) {
         sof->components = NULL;
     } else {
-        sof->components = (struct ComponentSOF *) malloc(nb_components * sizeof(struct ComponentSOF));
-        if(check_memory_allocation((void *) sof->components)) return EXIT_FAILURE;
+        sof->components = (struct ComponentSOF *) malloc(MAX_NUMBER_OF_COMPONENTS * sizeof(struct ComponentSOF));
+        if(check_memory_allocation((void *) sof->components)) return setDecoderError(DECODER_ERROR_MEMORY);
         for(int i=0; i<nb_components; i++){
             initialize_component_sof(&(sof->components[i]), id, sampling_factor_x, sampling_factor_y, num_quantization_table);
         }
@@ -114,17 +134,48 @@ struct HuffmanTable {
     int8_t destination;
     size_t length;
     unsigned char *data;
-    struct node * huffman_tree;
+    struct HuffmanCanonical canonical;  // représentation canonique (maxcode / valoffset / huffval)
+    struct HuffmanLookup lookup;    // table de décodage rapide (codes courts)
+    struct ACFastLookup AC_fast;    // table combinée Run/Size + magnitude (tables AC uniquement)
     bool set;   // permet de savoir si la table de Huffman a été définie dans le header
+    bool shared;    // table standard précalculée (cf. prebuilt_huffman_tables) ou table du cache partagé (cf. table_cache.h) :
+                    // ni modifiée, ni libérée
+};
+
+// Tables de Huffman standard (annexe K), utilisées par la plupart des appareils photo et des encodeurs
+// Leurs tables de décodage sont calculées à la compilation (cf. tools/generate_standard_tables.c et le Makefile) :
+// une DHT identique pointe directement sur ces tables, sans construction ni allocation
+static const struct HuffmanTable prebuilt_huffman_tables[NB_OF_STANDARD_HUFFMAN_TABLES] = {
+    {0, 0, sizeof(standard_DC_luminance), (unsigned char *) standard_DC_luminance,
+     STANDARD_HUFFMAN_CANONICAL_0, STANDARD_HUFFMAN_LOOKUP_0, STANDARD_AC_FAST_LOOKUP_0, true, true},
+    {0, 1, sizeof(standard_DC_chrominance), (unsigned char *) standard_DC_chrominance,
+     STANDARD_HUFFMAN_CANONICAL_1, STANDARD_HUFFMAN_LOOKUP_1, STANDARD_AC_FAST_LOOKUP_1, true, true},
+    {1, 0, sizeof(standard_AC_luminance), (unsigned char *) standard_AC_luminance,
+     STANDARD_HUFFMAN_CANONICAL_2, STANDARD_HUFFMAN_LOOKUP_2, STANDARD_AC_FAST_LOOKUP_2, true, true},
+    {1, 1, sizeof(standard_AC_chrominance), (unsigned char *) standard_AC_chrominance,
+     STANDARD_HUFFMAN_CANONICAL_3, STANDARD_HUFFMAN_LOOKUP_3, STANDARD_AC_FAST_LOOKUP_3, true, true}
 };
 
-void initialize_ht(struct HuffmanTable *ht, int8_t class, int8_t destination, size_t length, unsigned char *data, struct node * huffman_tree, bool set){
+void initialize_ht(struct HuffmanTable *ht, int8_t class, int8_t destination, size_t length, unsigned char *data, bool set){
     ht->class = class;
     ht->destination = destination;
     ht->length = length;
     ht->data = data;
-    ht->huffman_tree = huffman_tree;
+    memset(&ht->canonical, 0, sizeof(struct HuffmanCanonical));
+    memset(&ht->lookup, 0, sizeof(struct HuffmanLookup));   // table vide : tous les codes partent dans les tableaux canoniques
+    memset(&ht->AC_fast, 0, sizeof(struct ACFastLookup));
     ht->set = set;
+    ht->shared = false;
+}
+
+// Table non définie, mise à la place des tables d'une structure réutilisée (cf. reset_JPEG_struct()) : sans allocation
+static const struct HuffmanTable unset_huffman_table = {.class = -1, .destination = -1, .set = false, .shared = true};
+
+// Libère une table de Huffman (et son contenu), sauf si elle est partagée (précalculée, ou dans le cache)
+static void free_huffman_table(struct HuffmanTable *ht){
+    if (ht == NULL || ht->shared) return;
+    free(ht->data);
+    free(ht);
 }
 
 int8_t get_ht_class(struct HuffmanTable *ht){
@@ -143,8 +194,16 @@ unsigned char * get_ht_data(struct HuffmanTable *ht){
     return ht->data;
 }
 
-struct node * get_ht_tree(struct HuffmanTable *ht){
-    return ht->huffman_tree;
+struct HuffmanCanonical * get_ht_canonical(struct HuffmanTable *ht){
+    return &ht->canonical;
+}
+
+struct HuffmanLookup * get_ht_lookup(struct HuffmanTable *ht){
+    return &ht->lookup;
+}
+
+struct ACFastLookup * get_ht_AC_fast_lookup(struct HuffmanTable *ht){
+    return &ht->AC_fast;
 }
 
 bool get_ht_set(struct HuffmanTable *ht){
@@ -159,27 +218,61 @@ struct ComponentSOS {
     int8_t DC_huffman_table_id;
     int8_t AC_huffman_table_id;
     size_t nb_of_MCUs;
-    int16_t **MCUs;
+    size_t nb_allocated_blocks;     // blocs alloués (>= nb_of_MCUs) : gardés d'une image à l'autre (cf. reset_JPEG_struct())
+    int16_t *coefficients;          // coefficients de tous les blocs, contigus (64 par bloc) et alignés sur COEFFICIENTS_ALIGNMENT
+    int16_t **MCUs;                 // MCUs[i] : début du bloc i dans coefficients
+    struct BlockInfo *blocks_info;  // un élément par bloc de MCUs (cf. decode_MCU())
 };
 
+// Alloue les nb_of_MCUs blocs de la composante en un seul morceau (plutôt qu'un malloc par bloc)
+// Les blocs déjà alloués (composante d'une image précédente) sont réutilisés s'ils suffisent : aucune allocation
+// La composante doit être initialisée (champs à zéro, ou blocs d'une image précédente)
+static int8_t allocate_component_blocks(struct ComponentSOS *component, size_t nb_of_MCUs){
+    if (nb_of_MCUs <= component->nb_allocated_blocks) {
+        component->nb_of_MCUs = nb_of_MCUs;
+        if (nb_of_MCUs != 0) memset(component->blocks_info, 0, nb_of_MCUs * sizeof(struct BlockInfo));
+        return EXIT_SUCCESS;
+    }
+    free_component_blocks(component);
+
+    void *coefficients = NULL;
+    if (posix_memalign(&coefficients, COEFFICIENTS_ALIGNMENT, nb_of_MCUs * NB_VALUES_IN_8x8_BLOCK * sizeof(int16_t)) != 0) {
+        fprintf(stderr, RED("ERROR : MEMORY - extract.c > allocate_component_blocks()\n"));
+        return setDecoderError(DECODER_ERROR_MEMORY);
+    }
+    component->coefficients = (int16_t *) coefficients;
+
+    component->MCUs = (int16_t **) malloc(nb_of_MCUs * sizeof(int16_t *));
+    component->blocks_info = (struct BlockInfo *) calloc(nb_of_MCUs, sizeof(struct BlockInfo));
+    if (check_memory_allocation((void *) component->MCUs) || check_memory_allocation((void *) component->blocks_info)) {
+        free_component_blocks(component);
+        return setDecoderError(DECODER_ERROR_MEMORY);
+    }
+    for (size_t i = 0; i < nb_of_MCUs; i++) {
+        component->MCUs[i] = component->coefficients + i * NB_VALUES_IN_8x8_BLOCK;
+    }
+    component->nb_of_MCUs = nb_of_MCUs;
+    component->nb_allocated_blocks = nb_of_MCUs;
+    return EXIT_SUCCESS;
+}
+
+// Libère les blocs de la composante (3 free quel que soit le nombre de blocs)
+void free_component_blocks(struct ComponentSOS *component){
+    free(component->coefficients);
+    free(component->MCUs);
+    free(component->blocks_info);
+    component->nb_of_MCUs = 0;
+    component->nb_allocated_blocks = 0;
+    component->coefficients = NULL;
+    component->MCUs = NULL;
+    component->blocks_info = NULL;
+}
+
 int8_t initialize_component_sos(struct ComponentSOS *component, int8_t id_table, int8_t DC_huffman_table_id, int8_t AC_huffman_table_id, size_t nb_of_MCUs){
     component->id_table = id_table;
     component->DC_huffman_table_id = DC_huffman_table_id;
     component->AC_huffman_table_id = AC_huffman_table_id;
-    component->nb_of_MCUs = nb_of_MCUs;
-    component->MCUs = (int16_t **) malloc(nb_of_MCUs * sizeof(int16_t *));
-    if(check_memory_allocation((void *) component->MCUs)) return EXIT_FAILURE;
-    for(size_t i=0; i<nb_of_MCUs; i++){
-        component->MCUs[i] = (int16_t *) malloc(64 * sizeof(int16_t));
-        if(check_memory_allocation((void *) component->MCUs[i])) {
-            for(size_t j=0; j<i; j++){
-                free(component->MCUs[j]);
-            }
-            free(component->MCUs);
-            return EXIT_FAILURE;
-        }
-    }
-    return EXIT_SUCCESS;
+    return allocate_component_blocks(component, nb_of_MCUs);
 }
 
 int8_t get_DC_huffman_table_id(struct ComponentSOS *component){
@@ -190,10 +283,22 @@ int8_t get_AC_huffman_table_id(struct ComponentSOS *component){
     return component->AC_huffman_table_id;
 }
 
+int8_t get_id_table(struct ComponentSOS *component){
+    return component->id_table;
+}
+
+int16_t *get_coefficients(struct ComponentSOS *component){
+    return component->coefficients;
+}
+
 int16_t **get_MCUs(struct ComponentSOS *component){
     return component->MCUs;
 }
 
+struct BlockInfo *get_blocks_info(struct ComponentSOS *component){
+    return component->blocks_info;
+}
+
 // int16_t *get_MCU(struct ComponentSOF *component, int index_of_mcu){
 //     return component->MCUs[index_of_mcu];
 // }
@@ -215,18 +320,15 @@ int8_t initialize_sos(struct StartOfScan *sos, int8_t nb_components, int8_t id_t
     if (nb_components == 0) {
         sos->components = NULL;
     } else {
-        sos->components = (struct ComponentSOS *) malloc(nb_components * sizeof(struct ComponentSOS));
-        if(check_memory_allocation((void *) sos->components)) return EXIT_FAILURE;
+        sos->components = (struct ComponentSOS *) calloc(MAX_NUMBER_OF_COMPONENTS, sizeof(struct ComponentSOS));
+        if(check_memory_allocation((void *) sos->components)) return setDecoderError(DECODER_ERROR_MEMORY);
         for(int i=0; i<nb_components; i++){
             if(initialize_component_sos(&(sos->components[i]), id_table, DC_huffman_table_id, AC_huffman_table_id, nb_of_MCU)) {
                 for(int j=0; j<i; j++){
-                    for(size_t k=0; k<nb_of_MCU; k++){
-                        free(sos->components[j].MCUs[k]);
-                    }
-                    free(sos->components[j].MCUs);
+                    free_component_blocks(&(sos->components[j]));
                 }
                 free(sos->components);
-                return EXIT_FAILURE;
+                return setDecoderError(DECODER_ERROR_MEMORY);
             }
         }
     }
@@ -236,6 +338,15 @@ int8_t initialize_sos(struct StartOfScan *sos, int8_t nb_components, int8_t id_t
     return EXIT_SUCCESS;
 }
 
+// Composantes du Start Of Scan : MAX_NUMBER_OF_COMPONENTS éléments alloués une seule fois (à zéro), puis réutilisés
+// avec leurs blocs par les images suivantes
+static int8_t allocate_sos_components(struct StartOfScan *sos){
+    if (sos->components != NULL) return EXIT_SUCCESS;
+    sos->components = (struct ComponentSOS *) calloc(MAX_NUMBER_OF_COMPONENTS, sizeof(struct ComponentSOS));
+    if (check_memory_allocation((void *) sos->components)) return setDecoderError(DECODER_ERROR_MEMORY);
+    return EXIT_SUCCESS;
+}
+
 int8_t get_sos_nb_components(struct StartOfScan *sos){
     return sos->nb_components;
 }
@@ -268,13 +379,63 @@ struct JPEG {
     struct StartOfFrame **start_of_frame;
     struct HuffmanTable **huffman_tables;
     struct StartOfScan **start_of_scan;
-    unsigned char *image_data;
+    struct ByteStream file;         // contenu du fichier (projeté en mémoire)
+    const unsigned char *image_data;    // données compressées du scan, dans file (byte stuffing et markers RSTn compris)
     unsigned long long image_data_size_in_bits;
+    uint16_t restart_interval;      // nombre de MCUs entre deux markers RSTn (0 si pas de DRI)
+    size_t *restart_offsets;        // position (en octets dans image_data) de chaque marker RSTn
+    size_t nb_restart_offsets;
+    size_t restart_offsets_size;    // taille allouée de restart_offsets
+    struct DecoderContext *context; // contexte du décodeur (affichage, erreurs) partagé avec les threads de décodage
+    bool header_only;               // en-tête seul (cf. extract_header()) : ni MCUs alloués, ni données compressées
+    bool progressive;               // image progressive (SOF2) : les coefficients sont répartis sur plusieurs scans
+    bool dequantized;               // coefficients déjà déquantifiés et dans l'ordre naturel (cf. decode_MCU()) : IQ() et IZZ() n'ont rien à faire
+    struct ProgressiveScan *scans;  // scans de l'image progressive, dans l'ordre du fichier
+    size_t nb_scans;
+    size_t scans_size;              // taille allouée de scans
+    struct HuffmanTable **retired_huffman_tables;   // tables redéfinies par une DHT mais utilisées par un scan précédent
+    size_t nb_retired_huffman_tables;
+    size_t retired_huffman_tables_size;
+    struct PreviewCallback preview; // aperçu de l'image progressive (function NULL : pas d'aperçu)
+    bool stream_frame;              // image d'un flux Motion-JPEG (cf. extract_frame()) : tables reprises de l'image précédente
+    uint8_t defined_huffman_tables; // tables de Huffman définies par une DHT de l'image (bit i : huffman_tables[i])
     uint8_t nb_huffman;
     uint8_t nb_quantization;
 };
 
 int8_t initialize_JPEG_struct(struct JPEG *jpeg){
+    jpeg->file.data = NULL;
+
+    jpeg->header_only = false;
+
+    jpeg->stream_frame = false;
+
+    jpeg->defined_huffman_tables = 0;
+
+    jpeg->progressive = false;
+
+    jpeg->dequantized = false;
+
+    jpeg->scans = NULL;
+
+    jpeg->nb_scans = 0;
+
+    jpeg->scans_size = 0;
+
+    jpeg->retired_huffman_tables = NULL;
+
+    jpeg->nb_retired_huffman_tables = 0;
+
+    jpeg->retired_huffman_tables_size = 0;
+
+    jpeg->preview.function = NULL;
+
+    jpeg->preview.user_data = NULL;
+
+    jpeg->image_data = NULL;
+
+    jpeg->image_data_size_in_bits = 0;
+
     jpeg->height = 0;
     
     jpeg->width = 0;
@@ -295,16 +456,26 @@ int8_t initialize_JPEG_struct(struct JPEG *jpeg){
 
     jpeg->nb_quantization = 0;
 
+    jpeg->restart_interval = 0;
+
+    jpeg->restart_offsets = NULL;
+
+    jpeg->nb_restart_offsets = 0;
+
+    jpeg->restart_offsets_size = 0;
+
+    jpeg->context = getDecoderContext();
+
     jpeg->quantization_tables = (struct QuantizationTable **) malloc(MAX_NUMBER_OF_QUANTIZATION_TABLES * sizeof(struct QuantizationTable *));
     if (check_memory_allocation((void *) jpeg->quantization_tables)) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     for (int i=0; i < MAX_NUMBER_OF_QUANTIZATION_TABLES; i++){
         jpeg->quantization_tables[i] = (struct QuantizationTable *) malloc(sizeof(struct QuantizationTable));
         if (check_memory_allocation((void *) jpeg->quantization_tables[i])) {
             free_JPEG_struct(jpeg);
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_MEMORY);
         }
         initialize_qt(jpeg->quantization_tables[i], -1, 0, NULL, false);
     }
@@ -312,54 +483,47 @@ int8_t initialize_JPEG_struct(struct JPEG *jpeg){
     jpeg->start_of_frame = (struct StartOfFrame **) malloc(1 * sizeof(struct StartOfFrame *));  // pour l'instant on a un seul frame ... à modifier pour mode progressif
     if (check_memory_allocation((void *) jpeg->start_of_frame)){
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     jpeg->start_of_frame[0] = (struct StartOfFrame *) malloc(sizeof(struct StartOfFrame));
     if (check_memory_allocation((void *) jpeg->start_of_frame[0])) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     if (initialize_sof(jpeg->start_of_frame[0], 0, -1, -1, -1, -1, false)) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
 
     jpeg->huffman_tables = (struct HuffmanTable **) malloc(MAX_NUMBER_OF_HUFFMAN_TABLES * sizeof(struct HuffmanTable *));
     if (check_memory_allocation((void *) jpeg->huffman_tables)) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     for (int i=0; i<4; i++){
         jpeg->huffman_tables[i] = (struct HuffmanTable *) malloc(sizeof(struct HuffmanTable));
         if (check_memory_allocation((void *) jpeg->huffman_tables[i])) {
             free_JPEG_struct(jpeg);
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_MEMORY);
         }
-        initialize_ht(jpeg->huffman_tables[i], -1, -1, 0, NULL, NULL, false);
+        initialize_ht(jpeg->huffman_tables[i], -1, -1, 0, NULL, false);
     }
 
     jpeg->start_of_scan = (struct StartOfScan **) malloc(1 * sizeof(struct StartOfScan *));  // pour l'instant on a un seul scan ... à modifier pour mode progressif
     if (check_memory_allocation((void *) jpeg->start_of_scan)) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     jpeg->start_of_scan[0] = (struct StartOfScan *) malloc(sizeof(struct StartOfScan));
     if (check_memory_allocation((void *) jpeg->start_of_scan[0])) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     if(initialize_sos(jpeg->start_of_scan[0], 0, -1, -1, -1, 0, false)) {
         free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
 
-    jpeg->image_data = (unsigned char *) malloc(INITIAL_DATA_SIZE * sizeof(unsigned char));
-    if (check_memory_allocation((void *) jpeg->image_data)) {
-        free_JPEG_struct(jpeg);
-        return EXIT_FAILURE;
-    }
-
-    jpeg->image_data_size_in_bits = 0;
 
     return EXIT_SUCCESS;
 }
@@ -372,12 +536,7 @@ void free_JPEG_struct(struct JPEG *jpeg){
     // On free les tables de quantification
     if (jpeg->quantization_tables != NULL) {
         for(int8_t i=0; i < MAX_NUMBER_OF_QUANTIZATION_TABLES; i++){
-            if (jpeg->quantization_tables[i] != NULL){
-                if (jpeg->quantization_tables[i]->data != NULL){
-                    free(jpeg->quantization_tables[i]->data);
-                }
-                free(jpeg->quantization_tables[i]);
-            }
+            free_quantization_table(jpeg->quantization_tables[i]);
         }
         free(jpeg->quantization_tables);
     }
@@ -398,33 +557,30 @@ void free_JPEG_struct(struct JPEG *jpeg){
     // On free les tables de Huffman
     if (jpeg->huffman_tables != NULL) {
         for(int8_t i=0; i < MAX_NUMBER_OF_HUFFMAN_TABLES; i++){
-            if (jpeg->huffman_tables[i] != NULL){
-                if (jpeg->huffman_tables[i]->data != NULL){
-                    free(jpeg->huffman_tables[i]->data);
-                }
-                if (jpeg->huffman_tables[i]->huffman_tree != NULL){
-                    free_huffman_tree(jpeg->huffman_tables[i]->huffman_tree);
-                }
-                free(jpeg->huffman_tables[i]);
-            }
+            free_huffman_table(jpeg->huffman_tables[i]);
         }
         free(jpeg->huffman_tables);
     }
 
+    // On free les tables de Huffman redéfinies en cours d'image (mode progressif)
+    for (size_t i = 0; i < jpeg->nb_retired_huffman_tables; i++) {
+        free_huffman_table(jpeg->retired_huffman_tables[i]);
+    }
+    free(jpeg->retired_huffman_tables);
+
+    // On free les scans de l'image progressive (leurs données sont dans le fichier), y compris ceux d'une image précédente
+    for (size_t i = 0; i < jpeg->scans_size; i++) {
+        free(jpeg->scans[i].restart_offsets);
+    }
+    free(jpeg->scans);
+
     // On free les Start Of Scan
     if (jpeg->start_of_scan != NULL) {
         for(int8_t i=0; i < 1; i++){    // pour l'instant on a un seul scan ... à modifier pour mode progressif
             if (jpeg->start_of_scan[i] != NULL){
                 if ((jpeg->start_of_scan[i])->components != NULL){
-                    for (int8_t j=0; j < jpeg->start_of_scan[i]->nb_components; j++){
-                        if (&((jpeg->start_of_scan[i])->components[j]) != NULL){
-                            for (size_t k=0; k < (&( (jpeg->start_of_scan[i])->components[j] ))->nb_of_MCUs; k++){
-                                if ((&((jpeg->start_of_scan[i])->components[j]))->MCUs[k] != NULL){
-                                    free(   (&((jpeg->start_of_scan[i])->components[j]))->MCUs[k]);
-                                }
-                            }
-                            free((&((jpeg->start_of_scan[i])->components[j]))->MCUs);
-                        }
+                    for (int8_t j=0; j < MAX_NUMBER_OF_COMPONENTS; j++){    // blocs gardés d'une image précédente compris
+                        free_component_blocks(&((jpeg->start_of_scan[i])->components[j]));
                     }
                     free((jpeg->start_of_scan[i])->components);
                 }
@@ -434,13 +590,82 @@ void free_JPEG_struct(struct JPEG *jpeg){
         free(jpeg->start_of_scan);
     }
     
-    // On free les données de l'image
-    if (jpeg->image_data != NULL) free(jpeg->image_data);
+    // On libère le contenu du fichier (qui contient les données de l'image)
+    close_byte_stream(&jpeg->file);
+
+    // On free les positions des intervalles de restart
+    if (jpeg->restart_offsets != NULL) free(jpeg->restart_offsets);
 
     // On free la structure JPEG
     free(jpeg);
 }
 
+// Remet la structure dans l'état d'initialize_JPEG_struct() pour lire une nouvelle image, sans rien libérer d'autre que
+// le fichier de l'image précédente et ses tables : composantes, blocs, positions des markers RSTn et scans sont gardés
+// keep_tables : les tables restent en place (image suivante d'un flux Motion-JPEG, cf. extract_frame_into())
+void reset_JPEG_struct(struct JPEG *jpeg, bool keep_tables){
+    close_byte_stream(&jpeg->file);
+    jpeg->image_data = NULL;
+    jpeg->image_data_size_in_bits = 0;
+
+    jpeg->header_only = false;
+    jpeg->stream_frame = false;
+    jpeg->defined_huffman_tables = 0;
+    jpeg->progressive = false;
+    jpeg->dequantized = false;
+    jpeg->preview.function = NULL;
+    jpeg->preview.user_data = NULL;
+    jpeg->context = getDecoderContext();
+
+    jpeg->height = 0;
+    jpeg->width = 0;
+    jpeg->nb_Mcu_Width = 0;
+    jpeg->nb_Mcu_Height = 0;
+    jpeg->nb_Mcu_Width_Strechted = 0;
+    jpeg->nb_Mcu_Height_Strechted = 0;
+    jpeg->Sampling_Factor_X = 1;
+    jpeg->Sampling_Factor_Y = 1;
+
+    jpeg->restart_interval = 0;
+    jpeg->nb_restart_offsets = 0;
+
+    // Scans progressifs : les tableaux de positions des markers RSTn restent alloués dans jpeg->scans
+    for (size_t i = 0; i < jpeg->nb_scans; i++) {
+        jpeg->scans[i].nb_restart_offsets = 0;
+    }
+    jpeg->nb_scans = 0;
+
+    for (size_t i = 0; i < jpeg->nb_retired_huffman_tables; i++) {
+        free_huffman_table(jpeg->retired_huffman_tables[i]);
+    }
+    jpeg->nb_retired_huffman_tables = 0;
+
+    // Les tables partagées (standard, cache) ne sont pas libérées : une image identique les retrouvera sans allocation
+    if (!keep_tables) {
+        for (int8_t i = 0; i < MAX_NUMBER_OF_HUFFMAN_TABLES; i++) {
+            free_huffman_table(jpeg->huffman_tables[i]);
+            jpeg->huffman_tables[i] = (struct HuffmanTable *) &unset_huffman_table;
+        }
+        for (int8_t i = 0; i < MAX_NUMBER_OF_QUANTIZATION_TABLES; i++) {
+            free_quantization_table(jpeg->quantization_tables[i]);
+            jpeg->quantization_tables[i] = (struct QuantizationTable *) &unset_quantization_table;
+        }
+    }
+    jpeg->nb_huffman = 0;
+    jpeg->nb_quantization = 0;
+
+    // Start Of Frame et Start Of Scan vides, mais leurs composantes (et les blocs de coefficients) restent allouées
+    jpeg->start_of_frame[0]->nb_components = 0;
+    jpeg->start_of_frame[0]->set = false;
+    jpeg->start_of_scan[0]->nb_components = 0;
+    jpeg->start_of_scan[0]->set = false;
+    if (jpeg->start_of_scan[0]->components != NULL) {
+        for (int8_t i = 0; i < MAX_NUMBER_OF_COMPONENTS; i++) {
+            jpeg->start_of_scan[0]->components[i].nb_of_MCUs = 0;
+        }
+    }
+}
+
 int16_t get_JPEG_height(struct JPEG *jpeg){
     return jpeg->height;
 }
@@ -489,7 +714,7 @@ struct StartOfScan ** get_JPEG_sos(struct JPEG *jpeg){
     return jpeg->start_of_scan;
 }
 
-unsigned char * get_JPEG_image_data(struct JPEG* jpeg){
+const unsigned char * get_JPEG_image_data(struct JPEG* jpeg){
     return jpeg->image_data;
 }
 
@@ -497,17 +722,56 @@ unsigned long long get_JPEG_image_data_size_in_bits(struct JPEG* jpeg){
     return jpeg->image_data_size_in_bits;
 }
 
+uint16_t get_JPEG_restart_interval(struct JPEG* jpeg){
+    return jpeg->restart_interval;
+}
 
-//**********************************************************************************************************************
-int8_t ignore_bytes(FILE *input, int nb_bytes){
-    unsigned char buffer[nb_bytes];
-    if(fread(buffer, nb_bytes, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > ignore_bytes()\n"));
-        return EXIT_FAILURE;
-    }
-    return EXIT_SUCCESS;
+size_t * get_JPEG_restart_offsets(struct JPEG* jpeg){
+    return jpeg->restart_offsets;
+}
+
+size_t get_JPEG_nb_restart_offsets(struct JPEG* jpeg){
+    return jpeg->nb_restart_offsets;
+}
+
+bool get_JPEG_header_only(struct JPEG* jpeg){
+    return jpeg->header_only;
+}
+
+struct DecoderContext * get_JPEG_context(struct JPEG* jpeg){
+    return jpeg->context;
+}
+
+bool get_JPEG_progressive(struct JPEG* jpeg){
+    return jpeg->progressive;
 }
 
+bool get_JPEG_dequantized(struct JPEG* jpeg){
+    return jpeg->dequantized;
+}
+
+void set_JPEG_dequantized(struct JPEG* jpeg, bool dequantized){
+    jpeg->dequantized = dequantized;
+}
+
+struct ProgressiveScan * get_JPEG_scans(struct JPEG* jpeg){
+    return jpeg->scans;
+}
+
+size_t get_JPEG_nb_scans(struct JPEG* jpeg){
+    return jpeg->nb_scans;
+}
+
+struct PreviewCallback get_JPEG_preview_callback(struct JPEG* jpeg){
+    return jpeg->preview;
+}
+
+void set_JPEG_preview_callback(struct JPEG* jpeg, struct PreviewCallback callback){
+    jpeg->preview = callback;
+}
+
+
+//**********************************************************************************************************************
 bool is_fully_initialized(struct JPEG *jpeg) {
     if (jpeg->start_of_frame[0]->set != true) return false;
     if (jpeg->start_of_scan[0]->set != true) return false;
@@ -516,11 +780,28 @@ bool is_fully_initialized(struct JPEG *jpeg) {
     for (uint8_t i=0; i<MAX_NUMBER_OF_HUFFMAN_TABLES; i++){
         (jpeg->huffman_tables[i]->set == true) ? nb_huffman++ : 0;
     }
-    if (nb_huffman != jpeg->nb_huffman) return false;
+    // En mode progressif les tables sont redéfinies entre les scans (et vérifiées à chaque scan, cf. get_progressive_SOS())
+    // Dans un flux Motion-JPEG, les tables viennent des images précédentes ou des tables standard
+    if (!jpeg->progressive && !jpeg->stream_frame && nb_huffman != jpeg->nb_huffman) return false;
+
+    // Chaque composante du scan doit trouver ses tables DC et AC (une table jamais définie reste unset_huffman_table)
+    if (!jpeg->progressive && !jpeg->stream_frame) {
+        struct StartOfScan *sos = jpeg->start_of_scan[0];
+        for (int8_t i = 0; i < sos->nb_components; i++) {
+            int8_t DC_huffman_table_id = sos->components[i].DC_huffman_table_id;
+            int8_t AC_huffman_table_id = sos->components[i].AC_huffman_table_id;
+            if (DC_huffman_table_id < 0 || DC_huffman_table_id > 1 || AC_huffman_table_id < 2 || AC_huffman_table_id > 3) return false;
+            if (!jpeg->huffman_tables[DC_huffman_table_id]->set || !jpeg->huffman_tables[AC_huffman_table_id]->set) return false;
+        }
+    }
 
-    uint8_t nb_quantization = 0;
-    for (uint8_t j=0; j<MAX_NUMBER_OF_QUANTIZATION_TABLES; j++){
-        (jpeg->quantization_tables[j]->set == true) ? nb_quantization++ : 0;
+    // Chaque composante de l'image doit trouver sa table de quantification (une table jamais définie reste
+    // unset_quantization_table, dont les coefficients nuls donneraient une composante uniforme sans erreur)
+    struct StartOfFrame *sof = jpeg->start_of_frame[0];
+    for (int8_t i = 0; i < sof->nb_components; i++) {
+        int8_t num_quantization_table = sof->components[i].num_quantization_table;
+        if (num_quantization_table < 0 || num_quantization_table >= MAX_NUMBER_OF_QUANTIZATION_TABLES) return false;
+        if (!jpeg->quantization_tables[num_quantization_table]->set) return false;
     }
     return true;
 }
@@ -536,41 +817,86 @@ int8_t divide_Y_sampling_factor(uint8_t chrominance_sampling_factor, uint8_t lum
 
 
 //**********************************************************************************************************************
-// Récupère les données de la table de quantification
-struct QuantizationTable * get_qt(FILE *input, unsigned char *buffer) {
+// Ajoute la table qt au cache partagé (clé : les key_length octets du segment, identifiant compris ; 0 : pas de clé)
+// Renvoie la table à utiliser : celle du cache, ou qt elle-même si le cache est plein
+static struct QuantizationTable * share_quantization_table(struct QuantizationTable *qt, const unsigned char *key, size_t key_length){
+    if (key_length == 0) return qt;
+
+    qt->shared = true;  // avant l'insertion : la table peut être utilisée par un autre thread dès qu'elle est dans le cache
+    struct QuantizationTable *cached_table = table_cache_insert(TABLE_CACHE_QUANTIZATION, key, key_length, qt);
+    if (cached_table != qt) {
+        qt->shared = false;
+        if (cached_table == NULL) return qt;
+        free_quantization_table(qt);    // un autre thread l'a ajoutée entre-temps
+    }
+    return cached_table;
+}
+
+
+// Récupère les données d'une table de quantification (identifiant, puis 64 valeurs) d'un segment DQT dont il reste
+// segment_length octets à lire : un segment peut contenir plusieurs tables (cf. get_DQT())
+// Si la table redéfinie est identique à celle de quantization_tables (image précédente d'un flux Motion-JPEG...),
+// on renvoie cette dernière telle quelle plutôt qu'une copie ; une table déjà lue par le processus vient du cache partagé
+struct QuantizationTable * get_qt(struct ByteStream *input, unsigned char *buffer, struct QuantizationTable **quantization_tables, size_t segment_length) {
     // On souhaite récupérer les tables de quantification
     getVerbose() ? printf("\nQuantization table\n"):0;
 
-    int16_t length = 0;
-    if(fread(&length, 2, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > get_qt() > length\n"));
+    // On enlève l'identifiant de la table : la table s'arrête après 64 valeurs, ou à la fin du segment
+    int16_t length = (segment_length - 1 > NB_VALUES_IN_8x8_BLOCK) ? NB_VALUES_IN_8x8_BLOCK : (int16_t) segment_length - 1;
+    getVerbose() ? printf("\tlongueur : %d\n", length):0;
+    if (segment_length == 0 || length <= 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_qt() > length\n"));
+        setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
         return NULL;
     }
-    length = (length << 8) | ((length >> 8) & 0xFF);
 
-    length = length - 2 - 1;
-    getVerbose() ? printf("\tlongueur : %d\n", length):0;
-    
+    if(read_bytes(input, buffer, 1)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_qt() > buffer\n"));
+        setDecoderError(DECODER_ERROR_READ);
+        return NULL;
+    }
+
+    // Table identique à celle en place : rien à recopier
+    if (buffer[0] == LUMINANCE_ID || buffer[0] == CHROMINANCE_ID) {
+        struct QuantizationTable *current_table = quantization_tables[buffer[0]];
+        if (current_table->set && current_table->length == (size_t) length && (size_t) length <= input->size - input->position
+            && memcmp(input->data + input->position, current_table->data, length) == 0) {
+            getVerbose() ? printf("\ttable %d inchangée\n", buffer[0]):0;
+            ignore_bytes(input, length);
+            return current_table;
+        }
+    }
+
+    // Table déjà lue dans une image précédente (cache partagé par le processus) : clé = identifiant + contenu
+    const unsigned char *segment = input->data + input->position - 1;
+    bool complete_segment = (size_t) length <= input->size - input->position;
+    if (complete_segment) {
+        struct QuantizationTable *cached_table = table_cache_find(TABLE_CACHE_QUANTIZATION, segment, length + 1);
+        if (cached_table != NULL) {
+            getVerbose() ? printf("\ttable %d (cache)\n", buffer[0]):0;
+            ignore_bytes(input, length);
+            return cached_table;
+        }
+    }
+
     struct QuantizationTable *qt = (struct QuantizationTable *) malloc(sizeof(struct QuantizationTable));
-    if (check_memory_allocation((void *) qt)) return NULL;
-    qt->data = (uint8_t *) malloc(length * sizeof(uint8_t *));
-    if (check_memory_allocation((void *) qt->data)) {
-        free(qt);
+    if (check_memory_allocation((void *) qt)) {
+        setDecoderError(DECODER_ERROR_MEMORY);
         return NULL;
     }
-    
-    if(fread(buffer, 1, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > get_qt() > buffer\n"));
-        free(qt->data);
+    qt->data = (uint8_t *) malloc(length * sizeof(uint8_t *));
+    if (check_memory_allocation((void *) qt->data)) {
         free(qt);
+        setDecoderError(DECODER_ERROR_MEMORY);
         return NULL;
     }
 
     if (buffer[0] == LUMINANCE_ID) {
-        if(fread(qt->data, length, 1, input) != 1){
+        if(read_bytes(input, qt->data, length)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_qt() > qt->data\n"));
             free(qt->data);
             free(qt);
+            setDecoderError(DECODER_ERROR_READ);
             return NULL;
         }
         // Affichage des tables de quantification
@@ -582,10 +908,11 @@ struct QuantizationTable * get_qt(FILE *input, unsigned char *buffer) {
         qt->id = LUMINANCE_ID;
 
     } else if (buffer[0] == CHROMINANCE_ID) {
-        if(fread(qt->data, length, 1, input) != 1){
+        if(read_bytes(input, qt->data, length)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_qt() > qt->data\n"));
             free(qt->data);
             free(qt);
+            setDecoderError(DECODER_ERROR_READ);
             return NULL;
         }
         // Affichage des tables de quantification
@@ -599,36 +926,88 @@ struct QuantizationTable * get_qt(FILE *input, unsigned char *buffer) {
         fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_qt()\n"));
         free(qt->data);
         free(qt);
+        setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
         return NULL;
     }
     qt->length = length;
     qt->set = true;
+    qt->shared = false;
+
+    // Table dans l'ordre naturel : les coefficients dé-zigzagués sont multipliés directement
+    // (l'IDCT prend les coefficients tels quels : pas de facteurs d'échelle à y intégrer)
+    memset(qt->dequantization, 0, sizeof(qt->dequantization));
+    for (int16_t k = 0; k < length && k < NB_VALUES_IN_8x8_BLOCK; k++) {
+        qt->dequantization[zigzag_table[k]] = qt->data[k];
+    }
 
-    return qt;
+    return share_quantization_table(qt, segment, complete_segment ? length + 1 : 0);
+}
+
+
+// Lit un segment DQT et met ses tables en place : un segment peut en contenir plusieurs à la suite (luminance puis
+// chrominance : encodeurs Motion-JPEG, appareils photo...)
+int8_t get_DQT(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg) {
+    int16_t length = 0;
+    if(read_bytes(input, &length, 2)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_DQT() > length\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    length = (length << 8) | ((length >> 8) & 0xFF);
+
+    length = length - 2;    // On enlève la longueur du segment
+    if (length <= 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_DQT() > length\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    size_t segment_length = length;
+    while (segment_length > 0) {
+        size_t table_start = input->position;
+
+        // BREAKING-UPDATE : on possède au maximum 2 tables de quantification (luminance et chrominance)
+        // index 0 : luminance
+        // index 1 : chrominance
+        struct QuantizationTable *quantization_table = get_qt(input, buffer, jpeg->quantization_tables, segment_length);
+        if (quantization_table == NULL) return getDecoderStatus();
+
+        if (quantization_table == jpeg->quantization_tables[quantization_table->id]) {
+            // Table inchangée : déjà en place
+        } else if(quantization_table->id == LUMINANCE_ID) {
+            free_quantization_table(jpeg->quantization_tables[0]);
+            jpeg->quantization_tables[0] = quantization_table;
+        } else {
+            free_quantization_table(jpeg->quantization_tables[1]);
+            jpeg->quantization_tables[1] = quantization_table;
+        }
+        jpeg->nb_quantization++;
+
+        segment_length -= input->position - table_start;
+    }
+    return EXIT_SUCCESS;
 }
 
 
 //**********************************************************************************************************************
 // Récupère les données du segment Start_Of_Frame
-int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
+int8_t get_SOF(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg) {
     getVerbose() ? printf("\nStart of frame\n"):0;
 
     if(ignore_bytes(input, 3)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > ignore_bytes()\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     } // On ignore la longueur et la précision
 
     int16_t height = 0;
-    if(fread(&height, 2, 1, input) != 1){
+    if(read_bytes(input, &height, 2)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > height\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     }
     height = (height << 8) | ((height >> 8) & 0xFF);
 
     int16_t width = 0;
-    if(fread(&width, 2, 1, input) != 1){
+    if(read_bytes(input, &width, 2)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > width\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     }
     width = (width << 8) | ((width >> 8) & 0xFF);
 
@@ -646,49 +1025,33 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
     getVerbose() ? printf("\tHauteur de l'image en pixel : %d\n", height):0;
     getVerbose() ? printf("\tLargeur de l'image en pixel : %d\n", width):0;
 
-    if(fread(buffer, 1, 1, input) != 1){
+    if(read_bytes(input, buffer, 1)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > nb_components\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     }
     int8_t nb_components = buffer[0];
 
     if (nb_components > 3 || nb_components == 2 || nb_components < 1) {
         fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_SOF() > nb_components\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
     }
     getVerbose() ? printf("\tNombre de composantes : %d\n", nb_components):0;
 
-    // On met à jour le nombre de mcus dans le Start Of Scan s'il existe
-    if (jpeg->start_of_scan[0]->nb_components == nb_components) {
-
-        for (int8_t i=0; i < nb_components; i++) {
-            jpeg->start_of_scan[0]->components[i].nb_of_MCUs = jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted;
-
-            (&(jpeg->start_of_scan[0]->components[i]))->MCUs = (int16_t **) malloc(jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted * sizeof(int16_t *));
-            if (check_memory_allocation((void *) (&(jpeg->start_of_scan[0]->components[i]))->MCUs)) return EXIT_FAILURE;
-
-            for (size_t j=0; j < jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted; j++) {
-                (&(jpeg->start_of_scan[0]->components[i]))->MCUs[j] = (int16_t *) malloc(64 * sizeof(int16_t));
-                if (check_memory_allocation((void *) (&(jpeg->start_of_scan[0]->components[i]))->MCUs[j])) return EXIT_FAILURE;
-            }
-        }
-    }
-
-    struct ComponentSOF *components = (struct ComponentSOF *) malloc(nb_components*sizeof(struct ComponentSOF));
-    if (check_memory_allocation((void *) components)) return EXIT_FAILURE;
+    // Composantes lues dans un tableau local, recopiées dans le Start Of Frame (alloué une seule fois) une fois validées
+    struct ComponentSOF components[MAX_NUMBER_OF_COMPONENTS];
 
     getVerbose() ? printf("\tComposantes :\n"):0;
     for (int8_t i=0; i<nb_components; i++){
-        if(fread(buffer, 1, 1, input) != 1){
+        if(read_bytes(input, buffer, 1)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > id_component\n"));
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_READ);
         }
         int8_t id_component = buffer[0]; // ID composante
         
         // Facteur d'échantillonnage
-        if(fread(buffer, 1, 1, input) != 1){
+        if(read_bytes(input, buffer, 1)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > sampling_factor\n"));
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_READ);
         }
         int8_t sampling_factor = buffer[0]; // Il faut faire une conversion car c'est un octet et on veut deux bits
 
@@ -697,7 +1060,7 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
 
         if (!is_valid_sampling_factors(sampling_factor_x, sampling_factor_y)) {
             fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_SOF() > sampling_factor\n"));
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
         }
 
 
@@ -705,7 +1068,7 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
             // && sampling_factor_x != 4 && sampling_factor_y != 4) {
             if ( (sampling_factor_x != 1 && sampling_factor_x != 2  ) || (sampling_factor_y != 1 && sampling_factor_y != 2) ) {
                 fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_SOF() > sampling_factor\n"));
-                return EXIT_FAILURE;
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
             }
             if ( sampling_factor_x == 2 && jpeg->nb_Mcu_Width % 2 == 1 ) {
                 jpeg->nb_Mcu_Width_Strechted++;
@@ -721,7 +1084,7 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
 
             if (!divide_Y_sampling_factor(sampling_factor_x, jpeg->Sampling_Factor_X) || !divide_Y_sampling_factor(sampling_factor_y, jpeg->Sampling_Factor_Y)){
                 fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_SOF() > sampling_factor\n"));
-                return EXIT_FAILURE;
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
             }
 
             // ce if sert à detecter si on a bien des composantes chrominance avec un facteur d'échantillonnage de 1
@@ -731,9 +1094,9 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
             //     return EXIT_FAILURE;
             // }
         }
-        if(fread(buffer, 1, 1, input) != 1){
+        if(read_bytes(input, buffer, 1)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_SOF() > num_quantization_table\n"));
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_READ);
         }
         int8_t num_quantization_table = buffer[0]; // Tables de quantification
         getVerbose() ? printf("\t\tID composante : %d\n", id_component):0;
@@ -747,12 +1110,22 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
         components[i].num_quantization_table = num_quantization_table;
     }
 
-    // On supprime les données précédentes
-    free(jpeg->start_of_frame[0]->components);  // attention il faudra modifier lorsque l'on aura plusieurs SOF -> mode progessif
+    // On alloue les MCUs du Start Of Scan s'il existe (nb_Mcu_*_Strechted ne sont connus qu'après les facteurs d'échantillonnage)
+    if (jpeg->start_of_scan[0]->nb_components == nb_components && !jpeg->header_only) {
+        for (int8_t i=0; i < nb_components; i++) {
+            if (allocate_component_blocks(&(jpeg->start_of_scan[0]->components[i]), jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted)) {
+                return setDecoderError(DECODER_ERROR_MEMORY);
+            }
+        }
+    }
 
-    // Et on met à jour les données
+    // On met à jour les données (le tableau des composantes est gardé d'une image à l'autre, cf. reset_JPEG_struct())
+    if (jpeg->start_of_frame[0]->components == NULL) {
+        jpeg->start_of_frame[0]->components = (struct ComponentSOF *) malloc(MAX_NUMBER_OF_COMPONENTS * sizeof(struct ComponentSOF));
+        if (check_memory_allocation((void *) jpeg->start_of_frame[0]->components)) return setDecoderError(DECODER_ERROR_MEMORY);
+    }
+    memcpy(jpeg->start_of_frame[0]->components, components, nb_components * sizeof(struct ComponentSOF));
     jpeg->start_of_frame[0]->nb_components = nb_components;
-    jpeg->start_of_frame[0]->components = components;
 
     jpeg->start_of_frame[0]->set = true;
 
@@ -761,23 +1134,89 @@ int8_t get_SOF(FILE *input, unsigned char *buffer, struct JPEG *jpeg) {
 
 
 //**********************************************************************************************************************
-// Récupère les données de la table de Huffman
-struct HuffmanTable * get_DHT(FILE *input, unsigned char *buffer) {
+// Construit une table de Huffman à partir du contenu d'un segment DHT (data, length octets, cf. standard_tables.h)
+// La table garde data (libérée avec la table)
+static struct HuffmanTable * create_huffman_table(int8_t class, int8_t destination, size_t length, unsigned char *data) {
+    struct HuffmanTable *huffman_table = (struct HuffmanTable *) malloc(sizeof(struct HuffmanTable));
+    if (check_memory_allocation((void *) huffman_table)) {
+        fprintf(stderr, RED("ERROR : MEMORY ALLOCATION - extract.c > get_huffman_table() > huffman_table\n"));
+        free(data);
+        return NULL;
+    }
+    huffman_table->class = class;
+    huffman_table->destination = destination;
+    huffman_table->length = length;
+    huffman_table->data = data;
+    if (build_huffman_table(data, length, &huffman_table->canonical, &huffman_table->lookup)) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_huffman_table() > build_huffman_table()\n"));
+        free(data);
+        free(huffman_table);
+        setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        return NULL;
+    }
+    if (class == 1) {
+        build_AC_fast_lookup(data, &huffman_table->AC_fast);
+    } else {
+        memset(&huffman_table->AC_fast, 0, sizeof(struct ACFastLookup));
+    }
+    huffman_table->set = true;
+    huffman_table->shared = false;
+
+    return huffman_table;
+}
+
+
+// Indice de la table de classe class (0 : DC, 1 : AC) et de destination destination dans jpeg->huffman_tables
+static int8_t get_huffman_table_index(int8_t class, int8_t destination) {
+    return (class == 0 ? 0 : 2) + (destination == 0 ? 0 : 1);
+}
+
+
+// Ajoute la table huffman_table au cache partagé (clé : les key_length octets du segment, classe/destination compris ;
+// 0 : pas de clé). Renvoie la table à utiliser : celle du cache, ou huffman_table elle-même si le cache est plein
+static struct HuffmanTable * share_huffman_table(struct HuffmanTable *huffman_table, const unsigned char *key, size_t key_length){
+    if (key_length == 0) return huffman_table;
+
+    huffman_table->shared = true;   // avant l'insertion : la table peut être utilisée par un autre thread dès qu'elle est dans le cache
+    struct HuffmanTable *cached_table = table_cache_insert(TABLE_CACHE_HUFFMAN, key, key_length, huffman_table);
+    if (cached_table != huffman_table) {
+        huffman_table->shared = false;
+        if (cached_table == NULL) return huffman_table;
+        free_huffman_table(huffman_table);  // un autre thread l'a ajoutée entre-temps
+    }
+    return cached_table;
+}
+
+
+// Récupère les données d'une table de Huffman (classe/destination, 16 nombres de codes par longueur, puis les symboles)
+// d'un segment DHT dont il reste segment_length octets à lire : un segment peut contenir plusieurs tables (cf. get_DHT())
+// Si la table redéfinie est identique à celle de huffman_tables (image précédente d'un flux Motion-JPEG, scans
+// progressifs...), on renvoie cette dernière : ses tables de décodage ne sont pas reconstruites
+// Une table standard (précalculée) ou déjà construite par le processus (cache partagé) n'est pas reconstruite non plus
+struct HuffmanTable * get_huffman_table(struct ByteStream *input, unsigned char *buffer, struct HuffmanTable **huffman_tables, size_t segment_length) {
     getVerbose() ? printf("\nHuffman table\n"):0;
 
-    int16_t length = 0; // Longueur du segment
-    if(fread(&length, 2, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > get_DHT() > length\n"));
+    int16_t length = (int16_t) segment_length - 1;  // On enlève la classe/destination de la table
+    if (segment_length == 0 || length <= 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_huffman_table() > length\n"));
+        setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
         return NULL;
     }
-    length = (length << 8) | ((length >> 8) & 0xFF);
 
-    length = length - 2 - 1; // On enlève la longueur du segment et l'octet de précision 
-    
-    if(fread(buffer, 1, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > get_DHT() > id_table\n"));
+    if(read_bytes(input, buffer, 1)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_huffman_table() > id_table\n"));
+        setDecoderError(DECODER_ERROR_READ);
         return NULL;
     }
+
+    // La table s'arrête après ses symboles (somme des 16 nombres de codes), ou à la fin du segment
+    if (length > MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK && MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK <= input->size - input->position) {
+        int16_t table_length = MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK;
+        for (int8_t i = 0; i < MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; i++) {
+            table_length += input->data[input->position + i];
+        }
+        if (table_length < length) length = table_length;
+    }
     int8_t id_table = buffer[0]; // ID de la table
     // Les 4 bits de poids fort indiquent la classe de la table (DC ou AC)
     // 0 : DC or lossless table,
@@ -789,18 +1228,52 @@ struct HuffmanTable * get_DHT(FILE *input, unsigned char *buffer) {
     int8_t destination = id_table & 0x0F;
     getVerbose() ? printf("\tClasse de la table : %d\n", class):0;
     getVerbose() ? printf("\tDestination de la table : %d\n", destination):0;
+
+    // Table identique à celle en place : rien à reconstruire
+    struct HuffmanTable *current_table = huffman_tables[get_huffman_table_index(class, destination)];
+    if (current_table->set && current_table->class == class && current_table->destination == destination
+        && current_table->length == (size_t) length && (size_t) length <= input->size - input->position
+        && memcmp(input->data + input->position, current_table->data, length) == 0) {
+        getVerbose() ? printf("\tTable inchangée\n"):0;
+        ignore_bytes(input, length);
+        return current_table;
+    }
+
+    // Table standard (annexe K) : ses tables de décodage sont précalculées
+    const struct HuffmanTable *prebuilt_table = &prebuilt_huffman_tables[get_huffman_table_index(class, destination)];
+    if (prebuilt_table->class == class && prebuilt_table->destination == destination
+        && prebuilt_table->length == (size_t) length && (size_t) length <= input->size - input->position
+        && memcmp(input->data + input->position, prebuilt_table->data, length) == 0) {
+        getVerbose() ? printf("\tTable standard\n"):0;
+        ignore_bytes(input, length);
+        return (struct HuffmanTable *) prebuilt_table;
+    }
+
+    // Table déjà construite pour une image précédente (cache partagé par le processus) : clé = classe/destination + contenu
+    const unsigned char *segment = input->data + input->position - 1;
+    bool complete_segment = (size_t) length <= input->size - input->position;
+    if (complete_segment) {
+        struct HuffmanTable *cached_table = table_cache_find(TABLE_CACHE_HUFFMAN, segment, length + 1);
+        if (cached_table != NULL) {
+            getVerbose() ? printf("\tTable du cache\n"):0;
+            ignore_bytes(input, length);
+            return cached_table;
+        }
+    }
+
     getVerbose() ? printf("\tDonnées de la table : %d", destination):0;
 
     // Contenu de la table
     unsigned char *huffman_data = (unsigned char *) malloc(length*sizeof(unsigned char));
     if (check_memory_allocation((void *) huffman_data)) {
-        fprintf(stderr, RED("ERROR : MEMORY ALLOCATION - extract.c > get_DHT() > huffman_data\n"));
+        fprintf(stderr, RED("ERROR : MEMORY ALLOCATION - extract.c > get_huffman_table() > huffman_data\n"));
         return NULL;
     }
 
-    if(fread(huffman_data, length, 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > get_DHT() > huffman_data\n"));
+    if(read_bytes(input, huffman_data, length)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_huffman_table() > huffman_data\n"));
         free(huffman_data);
+        setDecoderError(DECODER_ERROR_READ);
         return NULL;
     }
 
@@ -810,66 +1283,72 @@ struct HuffmanTable * get_DHT(FILE *input, unsigned char *buffer) {
     }
     getVerbose() ? printf("\n"):0;
 
-    struct HuffmanTable *huffman_table = (struct HuffmanTable *) malloc(sizeof(struct HuffmanTable));
-    if (check_memory_allocation((void *) huffman_table)) {
-        fprintf(stderr, RED("ERROR : MEMORY ALLOCATION - extract.c > get_DHT() > huffman_table\n"));
-        free(huffman_data);
-        return NULL;
+    struct HuffmanTable *huffman_table = create_huffman_table(class, destination, length, huffman_data);
+    if (huffman_table == NULL) return NULL;
+
+    return share_huffman_table(huffman_table, segment, complete_segment ? length + 1 : 0);
+} 
+
+
+//**********************************************************************************************************************
+// Récupère l'intervalle de restart (nombre de MCUs entre deux markers RSTn) du segment Define Restart Interval
+int8_t get_DRI(struct ByteStream *input, struct JPEG *jpeg){
+    getVerbose() ? printf("\nDefine Restart Interval\n"):0;
+
+    unsigned char dri[4];   // longueur du segment (2 octets) + intervalle de restart (2 octets)
+    if(read_bytes(input, dri, sizeof(dri))){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_DRI()\n"));
+        return setDecoderError(DECODER_ERROR_READ);
     }
-    huffman_table->class = class;
-    huffman_table->destination = destination;
-    huffman_table->length = length;
-    huffman_table->data = huffman_data;
-    if ( (huffman_table->huffman_tree = build_huffman_tree(huffman_data)) == NULL) {
-        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_DHT() > huffman_table->huffman_tree\n"));
-        free(huffman_data);
-        free(huffman_table);
-        return NULL;
+    uint16_t length = (dri[0] << 8) | dri[1];
+    if (length != 4) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_DRI() > length\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
     }
-    huffman_table->set = true;
+    jpeg->restart_interval = (dri[2] << 8) | dri[3];
+    getVerbose() ? printf("\tIntervalle de restart : %d MCUs\n", jpeg->restart_interval):0;
 
-    return huffman_table;
-} 
+    return EXIT_SUCCESS;
+}
 
 
 //**********************************************************************************************************************
 // Récupère les données du segment Start_Of_Scan
-int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg){
+int8_t get_SOS(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg){
     getVerbose() ? printf("\nStart of scan + data\n"):0;
     if(ignore_bytes(input, 2)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOS() > ignore_bytes()\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     } // Longueur du segment (ignoré)
 
-    if(fread(buffer, 1, 1, input) != 1){
+    if(read_bytes(input, buffer, 1)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOS() > nb_components\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     }
     int8_t nb_components = buffer[0]; // Nombre de composantes
 
     if (nb_components > 3 || nb_components == 2 || nb_components <= 0) {
         fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_SOS() > nb_components\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
     }
     jpeg->start_of_scan[0]->nb_components = nb_components;
     getVerbose() ? printf("\tNombre de composantes : %d\n", nb_components):0;
 
-    struct ComponentSOS *components = (struct ComponentSOS *) malloc(nb_components * sizeof(struct ComponentSOS));
-    if (check_memory_allocation((void *) components)) return EXIT_FAILURE;
+    // Composantes gardées d'une image à l'autre avec leurs blocs (cf. reset_JPEG_struct()) : libérées par free_JPEG_struct()
+    if (allocate_sos_components(jpeg->start_of_scan[0])) return getDecoderStatus();
+    struct ComponentSOS *components = jpeg->start_of_scan[0]->components;
 
     // Composantes
     for (int8_t i=0; i < nb_components; i++){
-        if(fread(buffer, 1, 1, input) != 1){
+        if(read_bytes(input, buffer, 1)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_SOS() > id_component\n"));
-            free(components);
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_READ);
         }
         int8_t id_component = buffer[0]; // ID composante
         
-        if(fread(buffer, 1, 1, input) != 1){
+        if(read_bytes(input, buffer, 1)){
             fprintf(stderr, RED("ERROR : READ - extract.c > get_SOS() > ht_ids\n"));
-            free(components);
-            return EXIT_FAILURE;
+            return setDecoderError(DECODER_ERROR_READ);
         }
         int8_t ht_ids = buffer[0]; // ID des tables de Huffman utilisées pour cette composante
 
@@ -879,6 +1358,7 @@ int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg){
         components[i].id_table = id_component;
         components[i].DC_huffman_table_id = DC_huffman_table_id;
         components[i].AC_huffman_table_id = AC_huffman_table_id;
+        components[i].nb_of_MCUs = 0;
 
         getVerbose() ? printf("\tID composante : %d\n", id_component):0;
         getVerbose() ? printf("\tDC_huffman_table_id : %d\n", DC_huffman_table_id):0;
@@ -886,20 +1366,10 @@ int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg){
 
         // On met à jour le nombre de mcus à partir des informations du Start Of Frame s'il existe
         // (si oui, la donnée de hauteur et largeur de l'image a été mise à jour dans la structure jpeg)
-        if (jpeg->start_of_frame[0]->nb_components == nb_components) {
-            
-            components[i].nb_of_MCUs = jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted;
-            components[i].MCUs = (int16_t **) malloc(jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted * sizeof(int16_t *));
-            if (check_memory_allocation((void *) components[i].MCUs)) {
-                free(components);
-                return EXIT_FAILURE;
-            }
-            for (size_t j=0; j < jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted; j++) {
-                (components[i].MCUs)[j] = (int16_t *) malloc(64 * sizeof(int16_t));
-                if (check_memory_allocation((void *) components[i].MCUs[j])) {
-                    free(components);
-                    return EXIT_FAILURE;
-                }
+        // (en-tête seul : les MCUs ne sont pas alloués)
+        if (jpeg->start_of_frame[0]->nb_components == nb_components && !jpeg->header_only) {
+            if (allocate_component_blocks(&components[i], jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted)) {
+                return setDecoderError(DECODER_ERROR_MEMORY);
             }
         }
     }
@@ -907,10 +1377,9 @@ int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg){
     // Paramètres ignorés
     if(ignore_bytes(input, 3)){
         fprintf(stderr, RED("ERROR : READ - extract.c > get_SOS() > ignore_bytes()\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_READ);
     } // Octet de début de spectre, octet de fin de spectre, approximation (ignorés)
 
-    jpeg->start_of_scan[0]->components = components;
     jpeg->start_of_scan[0]->set = true;
 
     return EXIT_SUCCESS;
@@ -918,267 +1387,735 @@ int8_t get_SOS(FILE *input, unsigned char *buffer, struct JPEG *jpeg){
 
 
 //**********************************************************************************************************************
-// Récupère les données du fichier JPEG
-struct JPEG * extract(char *filename) {
+// Parcourt les données compressées qui commencent à l'octet start de data jusqu'au marker qui les termine :
+// EOI, ou (stop_at_any_marker) le premier marker qui n'est pas un RSTn
+// La position de chaque marker RSTn (relative à start) est ajoutée à restart_offsets (agrandi si besoin)
+// Renvoie la position du marker de fin dans *end, ou DECODER_ERROR_INCONSISTENT_DATA (sans message) si les données
+// se terminent sans marker
+static int8_t delimit_scan_data(const unsigned char *data, size_t size, size_t start, bool stop_at_any_marker,
+                                size_t **restart_offsets, size_t *nb_restart_offsets, size_t *restart_offsets_size, size_t *end){
+    size_t i = start;
+
+    while (true) {
+        // Les octets 0xFF sont rares dans les données compressées : on saute directement au prochain
+        // (memchr() compare plusieurs octets à la fois, instructions SIMD selon la libc)
+        const unsigned char *next = (i < size) ? memchr(data + i, SEGMENT_START, size - i) : NULL;
+        if (next == NULL || (size_t) (next - data) + 1 >= size) {   // fin du fichier sans marker de fin
+            return DECODER_ERROR_INCONSISTENT_DATA;
+        }
+        i = next - data;
+
+        uint8_t marker = data[i + 1];
+        if (marker == 0x00) {   // byte stuffing (retiré par le lecteur de bits)
+            i += 2;
+        } else if (marker == SEGMENT_START) {   // octet de bourrage avant un marker
+            i++;
+        } else if (marker == EOI) {
+            break;
+        } else if (marker >= RST_0 && marker <= RST_7) {    // Marker RSTn : fin de l'intervalle de restart courant
+            if (*nb_restart_offsets >= *restart_offsets_size) {
+                size_t new_size = (*restart_offsets_size == 0) ? INITIAL_RESTART_OFFSETS_SIZE : 2 * *restart_offsets_size;
+                size_t *new_restart_offsets = realloc(*restart_offsets, new_size * sizeof(size_t));
+                if (check_memory_allocation((void *) new_restart_offsets)) return setDecoderError(DECODER_ERROR_MEMORY);
+                *restart_offsets = new_restart_offsets;
+                *restart_offsets_size = new_size;
+            }
+            (*restart_offsets)[(*nb_restart_offsets)++] = i - start;
+            getHighlyVerbose() ? fprintf(stderr, "\t\tMarker RST%d à l'octet %ld\n", marker - RST_0, i - start):0;
+            i += 2;
+        } else if (stop_at_any_marker) {    // marker suivant (DHT, DRI, SOS... entre deux scans progressifs)
+            break;
+        } else {    // autre marker : on ne le traite pas
+            i += 2;
+        }
+    }
 
-    // Ouverture et vérification de la présence du fichier
-    FILE *input;
-    if( (input = fopen(filename, "r")) == NULL) {
-        fprintf(stderr, RED("ERROR : OPEN - extract.c > extract() with file %s\n"), filename);
-        return NULL;
+    *end = i;
+    return EXIT_SUCCESS;
+}
+
+
+//**********************************************************************************************************************
+// Délimite les données compressées du scan qui commence à la position courante de input, jusqu'au marker EOI
+// Les données restent dans le fichier : on note seulement leur position et celle des markers RSTn
+int8_t find_scan_end(struct JPEG *jpeg, struct ByteStream *input){
+    size_t scan_start = input->position;
+    size_t scan_end;
+
+    // Le nombre de markers RSTn attendus est connu : un entre chaque paire d'intervalles de restart
+    // >>> on alloue restart_offsets une seule fois (il ne grandit que si le fichier contient des markers en trop)
+    // >>> celui d'une image précédente (cf. reset_JPEG_struct()) est réutilisé s'il est assez grand
+    if (jpeg->restart_interval != 0) {
+        size_t nb_intervals = (get_nb_MCUs(jpeg) + jpeg->restart_interval - 1) / jpeg->restart_interval;
+        if (nb_intervals > 1 && jpeg->restart_offsets_size < nb_intervals - 1) {
+            size_t *restart_offsets = (size_t *) realloc(jpeg->restart_offsets, (nb_intervals - 1) * sizeof(size_t));
+            if (check_memory_allocation((void *) restart_offsets)) return setDecoderError(DECODER_ERROR_MEMORY);
+            jpeg->restart_offsets = restart_offsets;
+            jpeg->restart_offsets_size = nb_intervals - 1;
+        }
+    }
+
+    int8_t status = delimit_scan_data(input->data, input->size, scan_start, false, &jpeg->restart_offsets, &jpeg->nb_restart_offsets, &jpeg->restart_offsets_size, &scan_end);
+    if (status == DECODER_ERROR_INCONSISTENT_DATA) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > find_scan_end() | EOI marker is missing\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    } else if (status) {
+        return status;
+    }
+
+    jpeg->image_data = input->data + scan_start;
+    jpeg->image_data_size_in_bits = 8 * (unsigned long long) (scan_end - scan_start);
+    input->position = scan_end + 2;
+    return EXIT_SUCCESS;
+}
+
+
+//**********************************************************************************************************************
+// Récupère les données du segment Start_Of_Scan d'une image progressive (SOF2)
+// Chaque scan est ajouté à jpeg->scans avec les tables de Huffman en vigueur
+// Au premier scan, on alloue (et met à zéro) les coefficients de toutes les composantes du Start Of Frame :
+// les scans suivants viennent compléter ces coefficients
+int8_t get_progressive_SOS(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg){
+    getVerbose() ? printf("\nStart of scan (progressif) + data\n"):0;
+
+    struct StartOfFrame *sof = jpeg->start_of_frame[0];
+    struct StartOfScan *sos = jpeg->start_of_scan[0];
+
+    if(ignore_bytes(input, 2)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_progressive_SOS() > ignore_bytes()\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    } // Longueur du segment (ignoré)
+
+    if(read_bytes(input, buffer, 1)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_progressive_SOS() > nb_components\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    int8_t nb_components = buffer[0];
+    if (nb_components < 1 || nb_components > sof->nb_components) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_progressive_SOS() > nb_components\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+    getVerbose() ? printf("\tNombre de composantes : %d\n", nb_components):0;
+
+    // Premier scan : les composantes du Start Of Scan sont celles du Start Of Frame, dans le même ordre
+    // (les composantes et leurs blocs sont gardés d'une image à l'autre, cf. reset_JPEG_struct())
+    if (!sos->set) {
+        if (allocate_sos_components(sos)) return getDecoderStatus();
+        struct ComponentSOS *components = sos->components;
+
+        size_t nb_of_MCUs = jpeg->header_only ? 0 : jpeg->nb_Mcu_Width_Strechted * jpeg->nb_Mcu_Height_Strechted;
+        for (int8_t i = 0; i < sof->nb_components; i++) {
+            if (initialize_component_sos(&components[i], sof->components[i].id, 0, 2, nb_of_MCUs)) {
+                return setDecoderError(DECODER_ERROR_MEMORY);
+            }
+            if (nb_of_MCUs != 0) memset(components[i].coefficients, 0, nb_of_MCUs * NB_VALUES_IN_8x8_BLOCK * sizeof(int16_t));
+        }
+        sos->nb_components = sof->nb_components;
+        sos->set = true;
+    }
+
+    if (jpeg->nb_scans >= jpeg->scans_size) {
+        size_t size = (jpeg->scans_size == 0) ? INITIAL_NB_OF_SCANS : 2 * jpeg->scans_size;
+        struct ProgressiveScan *scans = realloc(jpeg->scans, size * sizeof(struct ProgressiveScan));
+        if (check_memory_allocation((void *) scans)) return setDecoderError(DECODER_ERROR_MEMORY);
+        memset(scans + jpeg->scans_size, 0, (size - jpeg->scans_size) * sizeof(struct ProgressiveScan));
+        jpeg->scans = scans;
+        jpeg->scans_size = size;
+    }
+    // Le scan d'une image précédente (cf. reset_JPEG_struct()) garde son tableau de positions des markers RSTn
+    struct ProgressiveScan *scan = &jpeg->scans[jpeg->nb_scans];
+    size_t *restart_offsets = scan->restart_offsets;
+    size_t restart_offsets_size = scan->restart_offsets_size;
+    memset(scan, 0, sizeof(struct ProgressiveScan));
+    scan->restart_offsets = restart_offsets;
+    scan->restart_offsets_size = restart_offsets_size;
+    scan->nb_components = nb_components;
+    scan->restart_interval = jpeg->restart_interval;
+
+    // Composantes : on retrouve chacune dans le Start Of Frame à partir de son ID
+    int8_t DC_huffman_table_ids[3];
+    int8_t AC_huffman_table_ids[3];
+    for (int8_t i = 0; i < nb_components; i++) {
+        unsigned char component[2];     // ID composante + ID des tables de Huffman
+        if(read_bytes(input, component, sizeof(component))){
+            fprintf(stderr, RED("ERROR : READ - extract.c > get_progressive_SOS() > component\n"));
+            return setDecoderError(DECODER_ERROR_READ);
+        }
+        int8_t index = -1;
+        for (int8_t j = 0; j < sof->nb_components; j++) {
+            if ((uint8_t) sof->components[j].id == component[0]) index = j;
+        }
+        for (int8_t j = 0; j < i; j++) {
+            if (scan->component_indices[j] == index) index = -1;    // composante répétée dans le scan
+        }
+        if (index < 0) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_progressive_SOS() | unknown component %d\n"), component[0]);
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        scan->component_indices[i] = index;
+        DC_huffman_table_ids[i] = component[1] >> 4;
+        AC_huffman_table_ids[i] = (component[1] & 0x0F) + 2;    // On ajoute 2 car les index des tables_AC commencent à 2
+        getVerbose() ? printf("\tID composante : %d\n", component[0]):0;
+        getVerbose() ? printf("\tDC_huffman_table_id : %d\n", DC_huffman_table_ids[i]):0;
+        getVerbose() ? printf("\tAC_huffman_table_id : %d\n", AC_huffman_table_ids[i]):0;
+    }
+
+    // Bande spectrale et approximations successives
+    unsigned char spectral_selection[3];
+    if(read_bytes(input, spectral_selection, sizeof(spectral_selection))){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_progressive_SOS() > spectral_selection\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    scan->spectral_start = spectral_selection[0];
+    scan->spectral_end = spectral_selection[1];
+    scan->approximation_high = spectral_selection[2] >> 4;
+    scan->approximation_low = spectral_selection[2] & 0x0F;
+    getVerbose() ? printf("\tBande spectrale : %d..%d\n", scan->spectral_start, scan->spectral_end):0;
+    getVerbose() ? printf("\tApproximation : %d -> %d\n", scan->approximation_high, scan->approximation_low):0;
+
+    // Un scan DC (éventuellement entrelacé) ou un scan AC d'une seule composante (norme JPEG, annexe G.1.1.1)
+    bool DC_scan = (scan->spectral_start == 0);
+    if (scan->spectral_end > 63 || scan->spectral_start > scan->spectral_end || (DC_scan && scan->spectral_end != 0)
+        || (!DC_scan && nb_components != 1) || scan->approximation_high > 13 || scan->approximation_low > 13
+        || (scan->approximation_high != 0 && scan->approximation_high != scan->approximation_low + 1)) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_progressive_SOS() > spectral_selection\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    // Tables de Huffman du scan : la table DC ne sert qu'au premier passage DC, la table AC qu'aux scans AC
+    for (int8_t i = 0; i < nb_components; i++) {
+        bool DC_table_needed = DC_scan && scan->approximation_high == 0;
+        if (DC_huffman_table_ids[i] > 1 || AC_huffman_table_ids[i] > 3
+            || (DC_table_needed && !jpeg->huffman_tables[DC_huffman_table_ids[i]]->set)
+            || (!DC_scan && !jpeg->huffman_tables[AC_huffman_table_ids[i]]->set)) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_progressive_SOS() | missing huffman table\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        scan->DC_tables[i] = jpeg->huffman_tables[DC_huffman_table_ids[i]];
+        scan->AC_tables[i] = jpeg->huffman_tables[AC_huffman_table_ids[i]];
+
+        // Le Start Of Scan garde les dernières tables utilisées par chaque composante (cf. --probe)
+        struct ComponentSOS *component = &sos->components[scan->component_indices[i]];
+        if (DC_scan) {
+            component->DC_huffman_table_id = DC_huffman_table_ids[i];
+        } else {
+            component->AC_huffman_table_id = AC_huffman_table_ids[i];
+        }
+    }
+
+    jpeg->nb_scans++;
+    return EXIT_SUCCESS;
+}
+
+
+// Délimite les données compressées du dernier scan progressif lu, jusqu'au marker suivant (qui n'est pas consommé)
+int8_t find_progressive_scan_end(struct JPEG *jpeg, struct ByteStream *input){
+    struct ProgressiveScan *scan = &jpeg->scans[jpeg->nb_scans - 1];
+    size_t scan_start = input->position;
+    size_t scan_end;
+
+    int8_t status = delimit_scan_data(input->data, input->size, scan_start, true, &scan->restart_offsets, &scan->nb_restart_offsets, &scan->restart_offsets_size, &scan_end);
+    if (status == DECODER_ERROR_INCONSISTENT_DATA) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > find_progressive_scan_end() | EOI marker is missing\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    } else if (status) {
+        return status;
+    }
+
+    scan->data = input->data + scan_start;
+    scan->size = scan_end - scan_start;
+    input->position = scan_end;
+    getVerbose() ? printf("\tLongueur du scan (octets) : %zu\n", scan->size):0;
+    return EXIT_SUCCESS;
+}
+
+
+//**********************************************************************************************************************
+// Remplace la table de Huffman d'indice index par huffman_table
+// Les scans progressifs déjà lus gardent un pointeur vers l'ancienne table : elle est alors mise de côté jusqu'à
+// free_JPEG_struct() plutôt que libérée
+static int8_t replace_huffman_table(struct JPEG *jpeg, int8_t index, struct HuffmanTable *huffman_table){
+    struct HuffmanTable *previous_table = jpeg->huffman_tables[index];
+
+    if (jpeg->nb_scans == 0) {
+        free_huffman_table(previous_table);
+    } else {
+        if (jpeg->nb_retired_huffman_tables >= jpeg->retired_huffman_tables_size) {
+            size_t size = (jpeg->retired_huffman_tables_size == 0) ? 2 * MAX_NUMBER_OF_HUFFMAN_TABLES : 2 * jpeg->retired_huffman_tables_size;
+            struct HuffmanTable **retired_huffman_tables = realloc(jpeg->retired_huffman_tables, size * sizeof(struct HuffmanTable *));
+            if (check_memory_allocation((void *) retired_huffman_tables)) return setDecoderError(DECODER_ERROR_MEMORY);
+            jpeg->retired_huffman_tables = retired_huffman_tables;
+            jpeg->retired_huffman_tables_size = size;
+        }
+        jpeg->retired_huffman_tables[jpeg->nb_retired_huffman_tables++] = previous_table;
+    }
+    jpeg->huffman_tables[index] = huffman_table;
+    return EXIT_SUCCESS;
+}
+
+
+//**********************************************************************************************************************
+// Saute le segment dont le marker vient d'être lu (sa longueur, 2 octets, est comprise dans le segment)
+static int8_t skip_segment(struct ByteStream *input){
+    unsigned char length_bytes[2];
+    if (read_bytes(input, length_bytes, 2)) {
+        fprintf(stderr, RED("ERROR : READ - extract.c > skip_segment() > length\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    size_t length = (length_bytes[0] << 8) | length_bytes[1];
+    if (length < 2 || ignore_bytes(input, length - 2)) {
+        fprintf(stderr, RED("ERROR : READ - extract.c > skip_segment() | segment of %zu bytes\n"), length);
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// Place les tables de Huffman standard (précalculées) là où aucune DHT de l'image n'a défini de table
+// Une image d'un flux Motion-JPEG sans DHT utilise les tables standard : les tables d'une image précédente encore en
+// place ne servent qu'à éviter de reconstruire une table que l'image redéfinit à l'identique (cf. get_huffman_table())
+static int8_t set_standard_huffman_tables(struct JPEG *jpeg){
+    for (int8_t i = 0; i < MAX_NUMBER_OF_HUFFMAN_TABLES; i++) {
+        if ((jpeg->defined_huffman_tables & (1 << i)) || jpeg->huffman_tables[i] == &prebuilt_huffman_tables[i]) continue;
+
+        getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman %d >>> table standard\n", i) : 0;
+        if (replace_huffman_table(jpeg, i, (struct HuffmanTable *) &prebuilt_huffman_tables[i])) return getDecoderStatus();
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// Lit un segment DHT et met ses tables en place : un segment peut en contenir plusieurs à la suite (les quatre tables
+// d'un encodeur Motion-JPEG...)
+int8_t get_DHT(struct ByteStream *input, unsigned char *buffer, struct JPEG *jpeg) {
+    int16_t length = 0; // Longueur du segment
+    if(read_bytes(input, &length, 2)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > get_DHT() > length\n"));
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    length = (length << 8) | ((length >> 8) & 0xFF);
+
+    length = length - 2;    // On enlève la longueur du segment
+    if (length <= 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > get_DHT() > length\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    size_t segment_length = length;
+    while (segment_length > 0) {
+        size_t table_start = input->position;
+
+        // BREAKING-UPDATE : on possède au maximum 4 tables de Huffman
+        // index 0 >>> class|destination : 00 >>> DC|luminance
+        // index 1 >>> class|destination : 01 >>> DC|chrominance
+        // index 2 >>> class|destination : 10 >>> AC|luminance
+        // index 3 >>> class|destination : 11 >>> AC|chrominance
+        // Si une nouvelle table de Huffman redéfinie une table déjà existante, on supprime l'ancienne
+        struct HuffmanTable *huffman_table = get_huffman_table(input, buffer, jpeg->huffman_tables, segment_length);
+        if (huffman_table == NULL) return getDecoderStatus();
+        int8_t index;
+
+        if (huffman_table->class == 0) {    // DC
+            if (huffman_table->destination == 0) {  // Luminance
+                getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - DC Luminance >>> mise à jour !\n") : 0;
+                index = 0;
+            } else {    // Chrominance
+                getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - DC Chrominance >>> mise à jour !\n") : 0;
+                index = 1;
+            }
+        } else {    // AC
+            if (huffman_table->destination == 0) {  // Luminance
+                getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - AC Luminance >>> mise à jour !\n") : 0;
+                index = 2;
+            } else {    // Chrominance
+                getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - AC Chrominance >>> mise à jour !\n") : 0;
+                index = 3;
+            }
+        }
+        // Une table inchangée est déjà en place (cf. get_huffman_table())
+        if (huffman_table != jpeg->huffman_tables[index] && replace_huffman_table(jpeg, index, huffman_table)) {
+            free_huffman_table(huffman_table);
+            return getDecoderStatus();
+        }
+        jpeg->nb_huffman++;
+        jpeg->defined_huffman_tables |= 1 << index;
+
+        getHighlyVerbose() ? fprintf(stderr, "\t\tTables de Huffman:\n") : 0;
+        getHighlyVerbose() ? fprintf(stderr, "\t\t\tDC Luminance   : %p\n", jpeg->huffman_tables[0]) : 0;
+        getHighlyVerbose() ? fprintf(stderr, "\t\t\tDC Chrominance : %p\n", jpeg->huffman_tables[1]) : 0;
+        getHighlyVerbose() ? fprintf(stderr, "\t\t\tAC Luminance   : %p\n", jpeg->huffman_tables[2]) : 0;
+        getHighlyVerbose() ? fprintf(stderr, "\t\t\tAC Chrominance : %p\n", jpeg->huffman_tables[3]) : 0;
+
+        segment_length -= input->position - table_start;
+    }
+    return EXIT_SUCCESS;
+}
+
+
+static struct JPEG * extract_segments(struct ByteStream file, bool header_only, bool stream_frame, struct JPEG *previous_frame, struct JPEG *recycled);
+
+
+//**********************************************************************************************************************
+// Récupère les données du fichier JPEG
+// Lecture de l'en-tête (jusqu'au SOS) et repérage des données compressées dans le flux file
+// source_name ne sert qu'aux messages d'erreur
+// header_only : on s'arrête au premier SOS, sans chercher la fin des données compressées
+// stream_frame : image d'un flux Motion-JPEG (cf. extract_frame()), qui reprend les tables de previous_frame (ou NULL)
+// recycled : structure d'une image précédente réutilisée telle quelle (cf. reset_JPEG_struct()), ou NULL pour une
+// nouvelle structure ; en cas d'erreur, elle est libérée comme la nouvelle structure l'aurait été
+static struct JPEG * extract_stream(struct ByteStream file, const char *source_name, bool header_only, bool stream_frame, struct JPEG *previous_frame, struct JPEG *recycled) {
+
+    struct ByteStream *input = &file;
+
+    // Image d'un flux Motion-JPEG : seul le marker SOI est exigé (pas d'en-tête JFIF, les segments APPn sont ignorés)
+    if (stream_frame) {
+        unsigned char first2bytes[2];
+        if (read_bytes(input, first2bytes, sizeof(first2bytes)) || first2bytes[0] != SEGMENT_START || first2bytes[1] != SOI) {
+            fprintf(stderr, RED("ERROR : FORMAT - extract.c > extract_frame() | SOI marker is missing\n"));
+            close_byte_stream(input);
+            free_JPEG_struct(recycled);
+            setDecoderError(DECODER_ERROR_FORMAT);
+            return NULL;
+        }
+        return extract_segments(file, header_only, stream_frame, previous_frame, recycled);
     }
 
     // Vérification conformité fichier via JPEG Magic number 
     unsigned char first4bytes[FOUR_BYTES_LONG];
-    if(fread(first4bytes, sizeof(first4bytes), 1, input) != 1){
+    if(read_bytes(input, first4bytes, sizeof(first4bytes))){
         fprintf(stderr, RED("ERROR : READ - extract.c > extract() > JPEG Magic number\n"));
-        fclose(input);
+        close_byte_stream(input);
+        free_JPEG_struct(recycled);
+        setDecoderError(DECODER_ERROR_READ);
         return NULL;
     }
+    // Le premier segment est l'en-tête JFIF (APP0) ou Exif (APP1, appareils photo)
     unsigned char JPEG_magic_Number[FOUR_BYTES_LONG] = {SEGMENT_START, SOI, SEGMENT_START, APP0};
+    bool exif = (first4bytes[3] == APP1);
 
     for (int i=0; i<4; i++){
-        if (first4bytes[i] != JPEG_magic_Number[i]){
-            fprintf(stderr, RED("ERROR : FORMAT - extract.c > extract() with file %s\n"), filename);
-            fclose(input);
+        if (first4bytes[i] != JPEG_magic_Number[i] && !(i == 3 && exif)){
+            fprintf(stderr, RED("ERROR : FORMAT - extract.c > extract() with file %s\n"), source_name);
+            close_byte_stream(input);
+            free_JPEG_struct(recycled);
+            setDecoderError(DECODER_ERROR_FORMAT);
             return NULL;
         }
     }
 
-    if(ignore_bytes(input, 2)){
-        fprintf(stderr, RED("ERROR : READ - extract.c > extract() > ignore_bytes()\n"));
-        fclose(input);
+    unsigned char length_bytes[2];
+    if(read_bytes(input, length_bytes, sizeof(length_bytes))){
+        fprintf(stderr, RED("ERROR : READ - extract.c > extract() > read_bytes() (segment length)\n"));
+        close_byte_stream(input);
+        free_JPEG_struct(recycled);
+        setDecoderError(DECODER_ERROR_READ);
         return NULL;
-    } // Ignorer les 2 octets suivants (longueur du segment)
-
-    // Vérification de la conformité du fichier avec JFIF
-    unsigned char JFIF[5] = {0x4A, 0x46, 0x49, 0x46, 0x00}; // JFIF suivi de 0
-    unsigned char buffer_2[5];
-    if(fread(buffer_2, sizeof(buffer_2), 1, input) != 1){
-        fprintf(stderr, RED("ERROR : READ - extract.c > extract() > buffer_2 (JFIF)\n"));
-        fclose(input);
+    }
+    size_t length = (length_bytes[0] << 8) | length_bytes[1];
+
+    // Vérification de la conformité du fichier avec JFIF ("JFIF" suivi de 0) ou Exif ("Exif" suivi de deux 0)
+    unsigned char JFIF[5] = {0x4A, 0x46, 0x49, 0x46, 0x00};
+    unsigned char Exif[6] = {0x45, 0x78, 0x69, 0x66, 0x00, 0x00};
+    const unsigned char *identifier = exif ? Exif : JFIF;
+    size_t identifier_length = exif ? sizeof(Exif) : sizeof(JFIF);
+    unsigned char buffer_2[6];
+    if(read_bytes(input, buffer_2, identifier_length)){
+        fprintf(stderr, RED("ERROR : READ - extract.c > extract() > buffer_2 (%s)\n"), exif ? "Exif" : "JFIF");
+        close_byte_stream(input);
+        free_JPEG_struct(recycled);
+        setDecoderError(DECODER_ERROR_READ);
         return NULL;
     }
 
-    for (int i=0; i<5; i++){
-        if (buffer_2[i] != JFIF[i]){
-            fprintf(stderr, RED("ERROR : FORMAT - extract.c > extract() with file %s\n"), filename);
-            fclose(input);
+    for (size_t i=0; i<identifier_length; i++){
+        if (buffer_2[i] != identifier[i]){
+            fprintf(stderr, RED("ERROR : FORMAT - extract.c > extract() with file %s\n"), source_name);
+            close_byte_stream(input);
+            free_JPEG_struct(recycled);
+            setDecoderError(DECODER_ERROR_FORMAT);
             return NULL;
         }
     }
 
+    // Le reste du segment Exif (métadonnées, vignette JPEG : cf. exif.h) est sauté d'un bloc, sans être parcouru
+    if (exif && (length < 2 + identifier_length || ignore_bytes(input, length - 2 - identifier_length))) {
+        fprintf(stderr, RED("ERROR : READ - extract.c > extract() | Exif segment of %zu bytes\n"), length);
+        close_byte_stream(input);
+        free_JPEG_struct(recycled);
+        setDecoderError(DECODER_ERROR_READ);
+        return NULL;
+    }
+
+    return extract_segments(file, header_only, stream_frame, previous_frame, recycled);
+}
+
+
+// Lecture des segments qui suivent l'en-tête (SOI, APP0 ou APP1), jusqu'au SOS (séquentiel) ou au marker EOI (progressif)
+static struct JPEG * extract_segments(struct ByteStream file, bool header_only, bool stream_frame, struct JPEG *previous_frame, struct JPEG *recycled) {
+
+    struct ByteStream *input = &file;
+
     // Récupération des données de l'en-tête
     unsigned char buffer[1];    // Buffer
     unsigned char id[1];        // Buffer de lecture pour déterminer le type de segments
 
-    struct JPEG *jpeg = (struct JPEG *) malloc(1 * sizeof(struct JPEG));
-    if (check_memory_allocation((void *) jpeg)) {
-        fclose(input);
-        return NULL;
+    // Structure réutilisée : déjà remise à zéro (cf. extract_into()), ses allocations servent à la nouvelle image
+    struct JPEG *jpeg = recycled;
+    if (jpeg == NULL) {
+        jpeg = (struct JPEG *) malloc(1 * sizeof(struct JPEG));
+        if (check_memory_allocation((void *) jpeg)) {
+            close_byte_stream(input);
+            return NULL;
+        }
+
+        if (initialize_JPEG_struct(jpeg)) {
+            close_byte_stream(input);
+            return NULL;
+        }
     }
-    
-    if (initialize_JPEG_struct(jpeg)) {
-        fclose(input);
-        return NULL;
+
+    // La structure JPEG garde la projection du fichier : les données compressées y restent jusqu'à free_JPEG_struct()
+    jpeg->file = file;
+    input = &jpeg->file;
+    jpeg->header_only = header_only;
+    jpeg->stream_frame = stream_frame;
+    jpeg->defined_huffman_tables = 0;
+
+    // Flux Motion-JPEG : les tables de l'image précédente (déjà décodée) restent valables jusqu'à leur redéfinition
+    // On échange les pointeurs : previous_frame récupère les tables vides de la nouvelle structure
+    if (stream_frame && previous_frame != NULL) {
+        for (int8_t i = 0; i < MAX_NUMBER_OF_HUFFMAN_TABLES; i++) {
+            struct HuffmanTable *huffman_table = jpeg->huffman_tables[i];
+            jpeg->huffman_tables[i] = previous_frame->huffman_tables[i];
+            previous_frame->huffman_tables[i] = huffman_table;
+        }
+        for (int8_t i = 0; i < MAX_NUMBER_OF_QUANTIZATION_TABLES; i++) {
+            struct QuantizationTable *quantization_table = jpeg->quantization_tables[i];
+            jpeg->quantization_tables[i] = previous_frame->quantization_tables[i];
+            previous_frame->quantization_tables[i] = quantization_table;
+        }
     }
 
 
-    while (!feof(input)){ // On arrête la boucle si on arrive à la fin du fichier sans avoir lu de marker EOF
-        if(fread(buffer, 1, 1, input) != 1){
-            fprintf(stderr, RED("ERROR : READ - extract.c > extract() > !feof\n"));
-            fclose(input);
-            free(jpeg);
+    while (true){ // On arrête la boucle si on arrive à la fin du fichier sans avoir lu de marker EOF
+        if(read_bytes(input, buffer, 1)){
+            fprintf(stderr, RED("ERROR : READ - extract.c > extract() > end of file\n"));
+            free_JPEG_struct(jpeg);
+            setDecoderError(DECODER_ERROR_READ);
             return NULL;
         }
 
         if (buffer[0] == SEGMENT_START){
-            if(fread(id, 1, 1, input) != 1){
+            if(read_bytes(input, id, 1)){
                 fprintf(stderr, RED("ERROR : READ - extract.c > extract() > SEGMENT_START\n"));
-                fclose(input);
-                free(jpeg);
+                free_JPEG_struct(jpeg);
+                setDecoderError(DECODER_ERROR_READ);
                 return NULL;
             }
             //**********************************************************************************************************************
             if (id[0] == DQT){
-                
-                // BREAKING-UPDATE : on possède au maximum 2 tables de quantification (luminance et chrominance)
-                // index 0 : luminance
-                // index 1 : chrominance
-                struct QuantizationTable *quantization_table = get_qt(input, buffer);
-                if (quantization_table == NULL) {
-                    fclose(input);
+
+                // Une ou plusieurs tables de quantification (cf. get_DQT())
+                if (get_DQT(input, buffer, jpeg)) {
                     free_JPEG_struct(jpeg);
                     return NULL;
                 }
-                
-                if(quantization_table->id == LUMINANCE_ID) {
-                    if (jpeg->quantization_tables[0]->data != NULL) free(jpeg->quantization_tables[0]->data);
-                    if (jpeg->quantization_tables[0] != NULL) free(jpeg->quantization_tables[0]);
-                    jpeg->quantization_tables[0] = quantization_table;
-                } else {
-                    if (jpeg->quantization_tables[1]->data != NULL) free(jpeg->quantization_tables[1]->data);
-                    if (jpeg->quantization_tables[1] != NULL) free(jpeg->quantization_tables[1]);
-                    jpeg->quantization_tables[1] = quantization_table;
-                }
-                jpeg->nb_quantization++;
 
             //**********************************************************************************************************************
-            } else if (id[0] == SOF_0){
+            } else if (id[0] == SOF_0 || id[0] == SOF_2){
 
+                // SOF2 : image progressive, les coefficients sont répartis sur plusieurs scans
+                jpeg->progressive = (id[0] == SOF_2);
                 if (get_SOF(input, buffer, jpeg)) {
-                    fclose(input);
                     free_JPEG_struct(jpeg);
                     return NULL;
                 }
 
             //**********************************************************************************************************************
             } else if (id[0] == DHT){
-                
-                // BREAKING-UPDATE : on possède au maximum 4 tables de Huffman
-                // index 0 >>> class|destination : 00 >>> DC|luminance
-                // index 1 >>> class|destination : 01 >>> DC|chrominance
-                // index 2 >>> class|destination : 10 >>> AC|luminance
-                // index 3 >>> class|destination : 11 >>> AC|chrominance
-                // Si une nouvelle table de Huffman redéfinie une table déjà existante, on supprime l'ancienne
-                struct HuffmanTable *huffman_table = get_DHT(input, buffer);
-                if (huffman_table == NULL) {
-                    fclose(input);
+
+                // Une ou plusieurs tables de Huffman (cf. get_DHT())
+                if (get_DHT(input, buffer, jpeg)) {
                     free_JPEG_struct(jpeg);
                     return NULL;
                 }
-                
-                if (huffman_table->class == 0) {    // DC
-                    if (huffman_table->destination == 0) {  // Luminance
-                        getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - DC Luminance >>> mise à jour !\n") : 0;
-                        free(jpeg->huffman_tables[0]->data);
-                        free(jpeg->huffman_tables[0]->huffman_tree);
-                        free(jpeg->huffman_tables[0]);
-                        jpeg->huffman_tables[0] = huffman_table;
-                    } else {    // Chrominance
-                        getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - DC Chrominance >>> mise à jour !\n") : 0;
-                        free(jpeg->huffman_tables[1]->data);
-                        free(jpeg->huffman_tables[1]->huffman_tree);
-                        free(jpeg->huffman_tables[1]);
-                        jpeg->huffman_tables[1] = huffman_table;
-                    }
-                } else {    // AC
-                    if (huffman_table->destination == 0) {  // Luminance
-                        getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - AC Luminance >>> mise à jour !\n") : 0;
-                        free(jpeg->huffman_tables[2]->data);
-                        free(jpeg->huffman_tables[2]->huffman_tree);
-                        free(jpeg->huffman_tables[2]);
-                        jpeg->huffman_tables[2] = huffman_table;
-                    } else {    // Chrominance
-                        getHighlyVerbose() ? fprintf(stderr, "\t\tTable de Huffman - AC Chrominance >>> mise à jour !\n") : 0;
-                        free(jpeg->huffman_tables[3]->data);
-                        free(jpeg->huffman_tables[3]->huffman_tree);
-                        free(jpeg->huffman_tables[3]);
-                        jpeg->huffman_tables[3] = huffman_table;
-                    }
+
+            //**********************************************************************************************************************
+            } else if ((id[0] >= APP0 && id[0] <= APP15) || id[0] == COM){
+
+                // Segments APPn (AVI1, Exif, FlashPix/MPF, Photoshop...) et commentaires ignorés, sautés d'un bloc
+                // Ils peuvent contenir une autre image JPEG (vignette Exif, image MPF : DQT, DHT, SOF, SOS...) qui ne doit
+                // pas être parcourue
+                if (skip_segment(input)) {
+                    free_JPEG_struct(jpeg);
+                    return NULL;
                 }
-                jpeg->nb_huffman++;
 
-                getHighlyVerbose() ? fprintf(stderr, "\t\tTables de Huffman:\n") : 0;
-                getHighlyVerbose() ? fprintf(stderr, "\t\t\tDC Luminance   : %p\n", jpeg->huffman_tables[0]) : 0;
-                getHighlyVerbose() ? fprintf(stderr, "\t\t\tDC Chrominance : %p\n", jpeg->huffman_tables[1]) : 0;
-                getHighlyVerbose() ? fprintf(stderr, "\t\t\tAC Luminance   : %p\n", jpeg->huffman_tables[2]) : 0;
-                getHighlyVerbose() ? fprintf(stderr, "\t\t\tAC Chrominance : %p\n", jpeg->huffman_tables[3]) : 0;
+            //**********************************************************************************************************************
+            } else if (id[0] == DRI){
+
+                if (get_DRI(input, jpeg)) {
+                    free_JPEG_struct(jpeg);
+                    return NULL;
+                }
 
             //**********************************************************************************************************************
             } else if (id[0] == SOS){
+
+                // Flux Motion-JPEG : les tables qu'aucune DHT de l'image n'a définies sont les tables standard
+                if (stream_frame && set_standard_huffman_tables(jpeg)) {
+                    free_JPEG_struct(jpeg);
+                    return NULL;
+                }
                 
-                if (get_SOS(input, buffer, jpeg)) {
-                    fclose(input);
+                if (jpeg->progressive ? get_progressive_SOS(input, buffer, jpeg) : get_SOS(input, buffer, jpeg)) {
                     free_JPEG_struct(jpeg);
                     return NULL;
                 }
 
-                // On lit la data en enlevant les 0 (à cause du byte stuffing)
-                unsigned long long data_size = INITIAL_DATA_SIZE; // On donne une estimation de la taille des données à récupérer
-
-                unsigned long long nb_data = 0;
-
-                while (!feof(input)){ // On arrête la boucle si on arrive à la fin du fichier sans avoir lu de marker EOF
-                    if(fread(buffer, 1, 1, input) != 1){
-                        fprintf(stderr, RED("ERROR : READ - extract.c > extract() id[0] == SOS > !feof\n"));
-                        fclose(input);
-                        free(jpeg);
+                // En-tête seul : le reste du fichier n'est pas lu
+                if (header_only) {
+                    if (!is_fully_initialized(jpeg)) {
+                        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > extract() | JPEG structure is not fully initialized\n"));
+                        free_JPEG_struct(jpeg);
+                        setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
                         return NULL;
                     }
+                    return jpeg;
+                }
 
-                    // On réalloue de la mémoire si on a besoin
-                    if(nb_data >= data_size -1){
-                        data_size *= 2;
-                        jpeg->image_data = realloc(jpeg->image_data, data_size * sizeof(unsigned char *));
-                        if (check_memory_allocation((void *) jpeg->image_data)) {
-                            fclose(input);
-                            free_JPEG_struct(jpeg);
-                            return NULL;
-                        }
+                // Image progressive : les scans se suivent, chacun s'arrête au marker suivant (DHT, DRI, SOS, EOI...)
+                if (jpeg->progressive) {
+                    if (find_progressive_scan_end(jpeg, input)) {
+                        free_JPEG_struct(jpeg);
+                        return NULL;
                     }
+                    continue;
+                }
 
-                    if (buffer[0] == SEGMENT_START){
-                        if(fread(buffer, 1, 1, input) != 1){
-                            fprintf(stderr, RED("ERROR : READ - extract.c > extract() id[0] == SOS > SEGMENT_START\n"));
-                            fclose(input);
-                            free(jpeg);
-                            return NULL;
-                        }
-
-                        if (buffer[0] == 0x00){ // On a du byte stuffing et on le supprime
-                            jpeg->image_data[nb_data] = SEGMENT_START;
-                            nb_data++;
-
-                        } else if (buffer[0] == EOI){   // On ne prend pas en compte le dernier 0xff du marker EOI
-                            jpeg->image_data_size_in_bits = 8 * nb_data;
-                            // On a fini la lecture des données
-                            getVerbose() ? printf("\tLongueur du bitstream_image_data (bits) : %lld\n", 8 * nb_data):0;
-                            getVerbose() ? printf("\tBitstream : "):0;
-                            for (size_t i =0; i < nb_data; i++) {
-                                getVerbose() ? printf("%x", (jpeg->image_data[i])):0;
-                            }
-                            getVerbose() ? printf("\nFin du fichier\n\n"):0;
-                            fclose(input);
-                            if (!is_fully_initialized(jpeg)) {
-                                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > extract() | JPEG structure is not fully initialized\n"));
-                                free_JPEG_struct(jpeg);
-                                return NULL;
-                            }
-                            return jpeg;
-
-                        } else if (feof(input)){    // On atteint la fin du fichier avant d'avoir lu un marker EOI
-                            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > extract() | EOI marker is missing\n"));
-                            fclose(input);
-                            free_JPEG_struct(jpeg);
-                            return NULL;
-
-                        } else {    // On a autre chose que du byte stuffing ou un marker autre que EOI ********** Remarque : si on a un autre marker que EOI, on ne le traite pas
-                            jpeg->image_data[nb_data] = 0xFF;
-                            nb_data++;
-                            jpeg->image_data[nb_data] = buffer[0];
-                            nb_data++;
-                        }
-
-                    } else {
-                        jpeg->image_data[nb_data] = buffer[0];
-                        nb_data++;
-                    }
+                // Les données compressées ne sont pas recopiées : on note seulement où elles se trouvent dans le fichier
+                // (le lecteur de bits retire le byte stuffing à la volée) et où se trouvent les markers RSTn
+                if (find_scan_end(jpeg, input)) {
+                    free_JPEG_struct(jpeg);
+                    return NULL;
                 }
 
+                getVerbose() ? printf("\tLongueur du bitstream_image_data (bits) : %lld\n", jpeg->image_data_size_in_bits):0;
+                getVerbose() ? printf("\tBitstream : "):0;
+                for (size_t i =0; i < jpeg->image_data_size_in_bits / 8; i++) {
+                    getVerbose() ? printf("%x", (jpeg->image_data[i])):0;
+                }
+                getVerbose() ? printf("\nFin du fichier\n\n"):0;
+                if (!is_fully_initialized(jpeg)) {
+                    fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > extract() | JPEG structure is not fully initialized\n"));
+                    free_JPEG_struct(jpeg);
+                    setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+                    return NULL;
+                }
+                return jpeg;
+
             //**********************************************************************************************************************
             } else if (id[0] == EOI){
                 getVerbose() ? printf("Fin du fichier\n"):0;
-                fclose(input);
                 if (!is_fully_initialized(jpeg)) {
                     fprintf(stderr, RED("ERROR : INCONSISTENT DATA - extract.c > extract() | JPEG structure is not fully initialized\n"));
                     free_JPEG_struct(jpeg);
+                    setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
                     return NULL;
                 }
                 break;
             }
         }
     }
-    fclose(input);
+    return jpeg;
+}
+
+
+struct JPEG * extract(char *filename) {
+    return extract_into(NULL, filename);
+}
+
+
+struct JPEG * extract_into(struct JPEG *jpeg, char *filename) {
+
+    // Nouveau fichier : on repart sans erreur dans le contexte du décodeur courant
+    resetDecoderStatus();
+    if (jpeg != NULL) reset_JPEG_struct(jpeg, false);
+
+    // Ouverture du fichier : il est projeté en mémoire, l'en-tête et les données sont lus directement dans la projection
+    struct ByteStream file;
+    if (open_byte_stream(&file, filename, false)) {
+        free_JPEG_struct(jpeg);
+        return NULL;
+    }
+
+    return extract_stream(file, filename, false, false, NULL, jpeg);
+}
+
+
+struct JPEG * extract_mem(const unsigned char *data, size_t size) {
+    return extract_mem_into(NULL, data, size);
+}
+
+
+struct JPEG * extract_mem_into(struct JPEG *jpeg, const unsigned char *data, size_t size) {
+
+    // Nouvelle image : on repart sans erreur dans le contexte du décodeur courant
+    resetDecoderStatus();
+    if (jpeg != NULL) reset_JPEG_struct(jpeg, false);
+
+    // Les données restent dans le buffer de l'appelant : ni copie, ni libération
+    struct ByteStream file;
+    open_memory_byte_stream(&file, data, size);
+
+    return extract_stream(file, "<memory>", false, false, NULL, jpeg);
+}
+
+
+struct JPEG * extract_header(char *filename) {
+
+    resetDecoderStatus();
+
+    struct ByteStream file;
+    if (open_byte_stream(&file, filename, true)) return NULL;
+
+    return extract_stream(file, filename, true, false, NULL, NULL);
+}
+
+
+struct JPEG * extract_header_mem(const unsigned char *data, size_t size) {
+
+    resetDecoderStatus();
+
+    struct ByteStream file;
+    open_memory_byte_stream(&file, data, size);
+
+    return extract_stream(file, "<memory>", true, false, NULL, NULL);
+}
+
+
+struct JPEG * extract_frame(const unsigned char *data, size_t size, struct JPEG *previous_frame, size_t *frame_size) {
+
+    resetDecoderStatus();
+
+    struct ByteStream file;
+    open_memory_byte_stream(&file, data, size);
+
+    struct JPEG *jpeg = extract_stream(file, "<frame>", false, true, previous_frame, NULL);
+    if (jpeg != NULL && frame_size != NULL) *frame_size = jpeg->file.position;
+    return jpeg;
+}
+
+
+struct JPEG * extract_frame_into(struct JPEG *jpeg, const unsigned char *data, size_t size, size_t *frame_size) {
+
+    resetDecoderStatus();
+    if (jpeg != NULL) reset_JPEG_struct(jpeg, true);    // les tables de l'image précédente restent en place
+
+    struct ByteStream file;
+    open_memory_byte_stream(&file, data, size);
+
+    jpeg = extract_stream(file, "<frame>", false, true, NULL, jpeg);
+    if (jpeg != NULL && frame_size != NULL) *frame_size = jpeg->file.position;
     return jpeg;
 }
@@ -1,115 +1,25 @@
+#define _POSIX_C_SOURCE 200809L    // sysconf()
+
 #include <stdio.h>
 #include <stdint.h>
 #include <string.h>
 #include <stdlib.h>
+#include <unistd.h>
+#include <pthread.h>
 
 #include <huffman.h>
 
-#define ONE 0x1
 #define EOB 0x00
 #define ZRL 0xf0
-#define MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK 16
-#define SYMBOLS_START_OFFSET_IN_DHT_SEGMENT 16
 #define MAX_MAGNITUDE_DC_VALUE 11
 #define MAX_MAGNITUDE_AC_VALUE 10
 #define MIN_MAGNITUDE_AC_VALUE 1
 #define NB_OF_COEFF_IN_8x8_BLOCK 64
+#define MAX_NB_OF_DECODING_THREADS 64
 
 
 
 //**********************************************************************************************************************
-// Structure représentant un noeud de l'arbre de Huffman
-struct node {
-    int8_t symbol;
-    struct node *left;
-    struct node *right;
-};
-
-
-// Crée un nouveau noeud de l'arbre de Huffman
-struct node *create_node(int8_t symbol, struct node *left, struct node *right) {
-    struct node *new_node = (struct node *) malloc(sizeof(struct node));
-    if (check_memory_allocation((void *) new_node)) return NULL;
-
-    new_node->symbol = symbol;
-    new_node->left = left;
-    new_node->right = right;
-    
-    return new_node;
-}
-
-
-//**********************************************************************************************************************
-// Construit l'arbre de huffman à partir de la table de huffman
-struct node * build_huffman_tree(unsigned char *ht_data) {
-    getHighlyVerbose() ? fprintf(stderr, "\tHuffman Tree :\n"):0;
-    // On vérifie que le pointeur de la table de Huffman existe
-    if (ht_data == NULL) {
-        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > build_huffman_tree()\n"));
-        return NULL;
-    }
-    // Il faut également vérifier que le nombre de code pour chaque longueur est valide ... ne fait pas vraiment le job mais c'est un début
-    for (uint16_t i = 0; i < MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; i++) {
-        uint16_t nb_max_symbols_per_level = (ONE << (i+1)) - 1;
-        getHighlyVerbose() ? fprintf(stderr, "\t\tnb_max_symbols_per_level: %d\n", nb_max_symbols_per_level):0;
-        getHighlyVerbose() ? fprintf(stderr, "\t\tNombre de codes: %d\n", ht_data[i]):0;
-        if (ht_data[i] > nb_max_symbols_per_level) {
-            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > build_huffman_tree() | too much symbols per level\n"));
-            return NULL;
-        }
-    }
-
-    struct node *root, *current_node;
-    if ( (root = create_node(0, NULL, NULL)) == NULL) return NULL;
-    size_t pos = SYMBOLS_START_OFFSET_IN_DHT_SEGMENT;
-    uint16_t code = 0;
-
-    getHighlyVerbose() ? fprintf(stderr, "\t\tSymbol(s): "):0;
-    for (int8_t i = 1; i <= MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; i++) {
-        for (int8_t j = 0; j < ht_data[i - 1]; j++) {
-            current_node = root;
-            for (int8_t k = i - 1; k >= 0; k--) {
-                if (code & (1 << k)) {
-                    if (!current_node->right) {
-                        if ( (current_node->right = create_node(0, NULL, NULL)) == NULL) {
-                            free_huffman_tree(root);
-                            return NULL;
-                        }
-                    }
-                    current_node = current_node->right;
-                } else {
-                    if (!current_node->left) {
-                        if ( (current_node->left = create_node(0, NULL, NULL)) == NULL) {
-                            free_huffman_tree(root);
-                            return NULL;
-                        }
-                    }
-                    current_node = current_node->left;
-                }
-            }
-
-            current_node->symbol = ht_data[pos++];
-            getHighlyVerbose() ? fprintf(stderr, " '%hhx' ", current_node->symbol):0;
-            code++;
-        }
-        code <<= 1;
-    }
-    getHighlyVerbose() ? fprintf(stderr, "\n"):0;
-    return root;
-}
-
-
-// Fonction qui free l'arbre de Huffman
-void free_huffman_tree(struct node *root) {
-    if (root == NULL) {
-        return;
-    }
-    free_huffman_tree(root->left);
-    free_huffman_tree(root->right);
-    free(root);
-}
-
-
 // Affiche la représentation binaire d'un entier
 void print_binary(uint16_t value, int16_t length) {
     for (int16_t i = length ; i >= 0; i--) {
@@ -140,32 +50,42 @@ void print_huffman_codes(int *bit_lengths, int8_t *symbols, int n) {
 
 
 //**********************************************************************************************************************
-// Renvoie la valeur du coefficient DC à partir de sa magnitude et de son indice dans la classe de magnitude
-int16_t recover_DC_coeff_value(int8_t magnitude, int16_t indice_dans_classe_magnitude, struct JPEG *jpeg) {
-    if (indice_dans_classe_magnitude < 0){
-        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > recover_DC_coeff_value()\n"));
-        free_JPEG_struct(jpeg);
-        exit(EXIT_FAILURE);
+// Décode le prochain symbole de Huffman à partir du lecteur de bits
+// Renvoie le symbole (et consomme le code) ou -1 si le code est invalide
+// Note : le réservoir doit contenir au moins MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK bits (cf. bit_reader_refill())
+int16_t decode_huffman_symbol(struct HuffmanTable *ht, struct BitReader *reader) {
+    // (1) Chemin rapide : un seul accès à la table de lookahead pour tous les codes de HUFFMAN_LOOKAHEAD_BITS bits ou moins
+    struct HuffmanLookup *lookup = get_ht_lookup(ht);
+    uint16_t look = bit_reader_peek(reader, HUFFMAN_LOOKAHEAD_BITS);
+    if (lookup->length[look] != 0) {
+        bit_reader_consume(reader, lookup->length[look]);
+        return lookup->symbol[look];
     }
-    if (magnitude != 0 && indice_dans_classe_magnitude < (1 << (magnitude - 1))){
-        indice_dans_classe_magnitude -= (1 << magnitude) - 1;
+
+    // (2) Chemin lent : codes plus longs (ou invalides), on compare le code à maxcode longueur par longueur
+    struct HuffmanCanonical *canonical = get_ht_canonical(ht);
+    uint16_t bits = bit_reader_peek(reader, MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK);
+    for (uint8_t length = HUFFMAN_LOOKAHEAD_BITS + 1; length <= MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; length++) {
+        int32_t code = bits >> (MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK - length);
+        if (code <= canonical->maxcode[length]) {
+            bit_reader_consume(reader, length);
+            return canonical->huffval[canonical->valoffset[length] + code];
+        }
     }
-    return indice_dans_classe_magnitude;
+    return -1;
+}
+
+
+//**********************************************************************************************************************
+// Renvoie la valeur du coefficient DC à partir de sa magnitude et de son indice dans la classe de magnitude
+int16_t recover_DC_coeff_value(int8_t magnitude, uint16_t indice_dans_classe_magnitude) {
+    return bit_reader_extend(indice_dans_classe_magnitude, magnitude);
 }
 
 
 // Renvoie la valeur du coefficient AC à partir de sa magnitude et de son indice dans la classe de magnitude
-int16_t recover_AC_coeff_value(int8_t magnitude, int16_t indice_dans_classe_magnitude, struct JPEG *jpeg) {
-    if (indice_dans_classe_magnitude < 0){
-        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > recover_AC_coeff_value()\n"));
-        free_JPEG_struct(jpeg);
-        exit(EXIT_FAILURE);
-    }
-    
-    if (indice_dans_classe_magnitude < (1 << (magnitude - 1))){
-        indice_dans_classe_magnitude -= (1 << magnitude) - 1;
-    }
-    return indice_dans_classe_magnitude;
+int16_t recover_AC_coeff_value(int8_t magnitude, uint16_t indice_dans_classe_magnitude) {
+    return bit_reader_extend(indice_dans_classe_magnitude, magnitude);
 }
 
 
@@ -173,16 +93,26 @@ int16_t recover_AC_coeff_value(int8_t magnitude, int16_t indice_dans_classe_magn
 // Décode un MCU
 // utilise les tables de Huffman de la composante
 // puis récupère les valeurs à encoder via RLE et encodage via magnitude
-int8_t decode_MCU(struct JPEG *jpeg, size_t MCU_number, int8_t component_index, int16_t* previous_DC_value, size_t *current_pos) {
+int8_t decode_MCU(struct JPEG *jpeg, size_t MCU_number, int8_t component_index, int16_t* previous_DC_value, struct BitReader *reader, bool dequantize_DC) {
     
     // On récupère les 64 valeurs du bloc 8x8
     struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), component_index);
-    unsigned char *bitstream = get_JPEG_image_data(jpeg);
-    size_t bitstream_size_in_bits = get_JPEG_image_data_size_in_bits(jpeg);
 
-    struct node *current_node = get_ht_tree(get_JPEG_ht(jpeg, get_DC_huffman_table_id(component)));
+    struct HuffmanTable *DC_table = get_JPEG_ht(jpeg, get_DC_huffman_table_id(component));
+    struct HuffmanTable *AC_table = get_JPEG_ht(jpeg, get_AC_huffman_table_id(component));
+    const struct ACFastEntry *AC_fast_entries = get_ht_AC_fast_lookup(AC_table)->entries;
+    // Table de quantification de la composante dans l'ordre naturel : les coefficients sont déquantifiés au vol
+    struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), component_index);
+    const uint16_t *dequantization = get_qt_dequantization(get_JPEG_qt(jpeg)[get_num_quantization_table(component_sof)]);
+    int16_t *block = get_MCUs(component)[MCU_number];
     int8_t nombre_de_valeurs_decodees = 0;
-    
+    uint8_t nb_nonzero = 0;     // nombre de coefficients non nuls du bloc
+    uint8_t last_nonzero = 0;   // indice (ordre zigzag) du dernier coefficient non nul
+    uint8_t position;           // place (ordre naturel) du coefficient courant dans le bloc
+    bool highly_verbose = getHighlyVerbose();
+
+    // On part d'un bloc nul : seuls les coefficients non nuls sont écrits ensuite
+    memset(block, 0, NB_OF_COEFF_IN_8x8_BLOCK * sizeof(int16_t));
 
     getHighlyVerbose() ? fprintf(stderr, "Decoding MCU:\n"):0;
     getHighlyVerbose() ? fprintf(stderr, "\tMCU#%ld:\n", MCU_number):0;
@@ -191,209 +121,292 @@ int8_t decode_MCU(struct JPEG *jpeg, size_t MCU_number, int8_t component_index,
     getHighlyVerbose() ? fprintf(stderr, "\t\t\tAC huffman table id: %d\n", get_AC_huffman_table_id(component)):0;
 
     // On décode pour trouver la valeur du coefficient DC
-    for (size_t i = *current_pos; i < bitstream_size_in_bits; i++) {
-        // (1) On lit le code de Huffman
-        // On détermine le bit actuel en inspectant l'octet approprié dans bitstream
-        // puis en décalant et en masquant le bit approprié
-        unsigned char current_bit = (bitstream[(size_t)(i / 8)] >> (7 - (i % 8))) & 1;
-
-        // On parcours l'arbre de Huffman à la recherche d'un mot de code
-        if (current_node == NULL){
-            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU()\n"));
-            return EXIT_FAILURE;
+    // (1) On lit le code de Huffman et on récupère la magnitude associée
+    // Après un rechargement le réservoir contient assez de bits pour le code (16 bits max) et la magnitude (11 bits max)
+    bit_reader_refill(reader);
+    int16_t magnitude_DC = decode_huffman_symbol(DC_table, reader);
+    getHighlyVerbose() ? fprintf(stderr, "\t\t\tmagnitude_DC :%x\n", magnitude_DC):0;
+
+    if (magnitude_DC < 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | invalid huffman code\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    } else if (magnitude_DC > MAX_MAGNITUDE_DC_VALUE) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_DC > MAX_MAGNITUDE_DC_VALUE\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    // (2) On récupère l'indice dans la classe de magnitude associé
+    uint16_t indice_dans_classe_magnitude_DC = bit_reader_get(reader, magnitude_DC);
+
+    // (3) On récupère finalement la valeur du coefficient DC à partir de la magnitude et de l'indice dans la classe de magnitude
+    int16_t DC_value = recover_DC_coeff_value(magnitude_DC, indice_dans_classe_magnitude_DC) + *previous_DC_value;
+    block[DC_VALUE_INDEX] = dequantize_DC ? dequantize_coefficient(DC_value, dequantization[DC_VALUE_INDEX]) : DC_value;
+    nombre_de_valeurs_decodees++;
+    nb_nonzero += (DC_value != 0);
+    *previous_DC_value = DC_value;
+    highly_verbose ? fprintf(stderr, "\t\t\t| %hx-%d |\n", DC_value, nombre_de_valeurs_decodees):0;
+
+    // On décode pour trouver les 63 valeurs des coefficients AC
+    while (nombre_de_valeurs_decodees < NB_OF_COEFF_IN_8x8_BLOCK) {
+        bit_reader_refill(reader);
+
+        // (0) Chemin rapide : code court + magnitude courte résolus en un seul accès à la table combinée
+        const struct ACFastEntry *fast_entry = &AC_fast_entries[bit_reader_peek(reader, AC_FAST_BITS)];
+        if (fast_entry->length != 0) {
+            bit_reader_consume(reader, fast_entry->length);
+            nombre_de_valeurs_decodees += fast_entry->run;
+            if (nombre_de_valeurs_decodees >= NB_OF_COEFF_IN_8x8_BLOCK) {
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | RLE exceeded MCU size\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            }
+            last_nonzero = nombre_de_valeurs_decodees;
+            nb_nonzero++;
+            position = zigzag_table[nombre_de_valeurs_decodees++];
+            block[position] = dequantize_coefficient(fast_entry->value, dequantization[position]);
+            highly_verbose ? fprintf(stderr, "\t\t\t| %hx-%d | \n", fast_entry->value, nombre_de_valeurs_decodees):0;
+            continue;
         }
 
-        current_node = (current_bit == 1) ? current_node->right : current_node->left;
+        // (1) On lit le code de Huffman pour récupérer le Run/Size associé :
+        // >>> 4 MSB : combien de coefficients nuls précèdent ce coefficient AC
+        // >>> 4 LSB : la magnitude du coefficient AC (Note: valeur comprise entre 0 et A >>> prévoir vérification de la conformité de la valeur lue)
+        int16_t run_and_size = decode_huffman_symbol(AC_table, reader);
+        highly_verbose ? fprintf(stderr, "\t\t\t\t>>> run_and_size = %x\n", run_and_size):0;
 
-        // On détecte une erreur éventuelle d'encodage
-        if (!current_node) {
-            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU()\n"));
-            return EXIT_FAILURE;
+        if (run_and_size < 0) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | invalid huffman code\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
         }
-        
-        if (!current_node->left && !current_node->right) {  // On est sur une feuille
-            // (2) On récupère la valeur de magnitude associée
-            int8_t magnitude_DC = current_node->symbol;
-            getHighlyVerbose() ? fprintf(stderr, "\t\t\tmagnitude_DC :%x\n", magnitude_DC):0;
-
-            if (magnitude_DC < 0) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_DC < 0\n"));
-                return EXIT_FAILURE;
-            } else if (magnitude_DC > MAX_MAGNITUDE_DC_VALUE) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_DC > MAX_MAGNITUDE_DC_VALUE\n"));
-                return EXIT_FAILURE;
+
+        // (2) On récupère la valeur du coefficient AC à partir du Run/Size
+        if (run_and_size == EOB){   // (2a) On gère le cas spécial EOB : les coefficients restants sont déjà nuls
+            break;  // On a fini de récupérer les valeurs des coefficients AC, on peut passer à la suite
+
+        } else if (run_and_size == ZRL){   // (2b) On gère le cas spécial ZRL : 16 coefficients nuls
+            if (nombre_de_valeurs_decodees + 16 > NB_OF_COEFF_IN_8x8_BLOCK) {
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | RLE exceeded MCU size\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            }
+            nombre_de_valeurs_decodees += 16;
+
+        } else {    // (2c) Sinon on saute le bon nombre de coefficients nuls avant le coefficient AC
+            uint8_t nb_de_coeff_nuls_a_ajouter_avant = run_and_size >> 4;
+            uint8_t magnitude_AC = run_and_size & 0x0F; // on récupère les 4 LSB en appliquant un masque
+            if (magnitude_AC > MAX_MAGNITUDE_AC_VALUE){
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_AC exceeds 15\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            } else if (magnitude_AC < MIN_MAGNITUDE_AC_VALUE){
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_AC is negative\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
             }
-            
-            // (3) On récupère l'indice dans la classe de magnitude associé
-            // Il faut lire le bon nombre de bit(s) ... et reconstruire l'indice bit après bit
-            getHighlyVerbose() ? fprintf(stderr, "\t\t\tmagnitude_DC = %x - indice_dans_la_classe_de_magnitude : ", magnitude_DC):0;
-            int16_t indice_dans_classe_magnitude_DC = 0;
-            for (int8_t j = 0; j < magnitude_DC; j++){
-                indice_dans_classe_magnitude_DC <<= 1;
-                int8_t current_bit = (bitstream[(i + 1 + j) / 8] >> (7 - ((i + 1 + j) % 8))) & 1;
-                indice_dans_classe_magnitude_DC += current_bit;
-                getHighlyVerbose() ? fprintf(stderr, "%d", current_bit):0;
+            if (nombre_de_valeurs_decodees + nb_de_coeff_nuls_a_ajouter_avant >= NB_OF_COEFF_IN_8x8_BLOCK) {
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | RLE exceeded MCU size\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
             }
-            getHighlyVerbose() ? fprintf(stderr, "\n"):0;
+            nombre_de_valeurs_decodees += nb_de_coeff_nuls_a_ajouter_avant;
+
+            // (3) Puis on récupère l'indice dans la classe de magnitude du coefficient AC
+            uint16_t indice_dans_classe_magnitude_AC = bit_reader_get(reader, magnitude_AC);
+
+            // (4) On récupère finalement la valeur du coefficient AC à partir de la magnitude et de l'indice dans la classe de magnitude
+            int16_t AC_value = recover_AC_coeff_value(magnitude_AC, indice_dans_classe_magnitude_AC);
+            last_nonzero = nombre_de_valeurs_decodees;
+            nb_nonzero++;
+            position = zigzag_table[nombre_de_valeurs_decodees++];
+            block[position] = dequantize_coefficient(AC_value, dequantization[position]);
+            highly_verbose ? fprintf(stderr, "\t\t\t| %hx-%d | \n", AC_value, nombre_de_valeurs_decodees):0;
+        }
+    }
 
-            // (4) On récupère finalement la valeur du coefficient DC à partir de la magnitude et de l'indice dans la classe de magnitude
-            int16_t DC_value = recover_DC_coeff_value(magnitude_DC, indice_dans_classe_magnitude_DC, jpeg) + *previous_DC_value;
-            set_value_in_MCU(component, MCU_number, nombre_de_valeurs_decodees++, DC_value);
-            *previous_DC_value = get_MCUs(component)[MCU_number][DC_VALUE_INDEX];
-            getHighlyVerbose() ? fprintf(stderr, "\t\t\t| %hx-%d |\n", DC_value, nombre_de_valeurs_decodees):0;
+    // On prévoit le cas où on a atteint la fin du bitstream sans avoir trouvé les 64 valeurs du MCU en cours de décodage
+    if (bit_reader_overrun(reader)) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | not enough values for current MCU#%ld\n"), MCU_number);
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
 
-            // On prépare la suite en repositionnant le current_node sur la racine de l'arbre des coefficients AC
-            current_node = get_ht_tree(get_JPEG_ht(jpeg, get_AC_huffman_table_id(component)));
+    // On garde la trace de la "densité" du bloc pour l'IDCT (indices dans l'ordre zigzag)
+    struct BlockInfo *block_info = &get_blocks_info(component)[MCU_number];
+    block_info->nb_nonzero = nb_nonzero;
+    block_info->last_nonzero = last_nonzero;
 
-            // Et on réaffecte la position courante dans le bitstream pour la suite
-            *current_pos = i + magnitude_DC + 1;
+    return EXIT_SUCCESS;
+}
 
-            break;  // On a récupéré la valeur du coefficient DC, on peut passer à la suite
+
+//**********************************************************************************************************************
+// Parcourt un bloc sans l'enregistrer (décodage spéculatif, cf. speculative.c)
+// Applique exactement les mêmes vérifications que decode_MCU() mais sans message d'erreur : des données invalides
+// sont attendues quand on démarre à une position arbitraire du bitstream
+int8_t skip_block(struct HuffmanTable *DC_table, struct HuffmanTable *AC_table, struct BitReader *reader){
+    const struct ACFastEntry *AC_fast_entries = get_ht_AC_fast_lookup(AC_table)->entries;
+
+    bit_reader_refill(reader);
+    int16_t magnitude_DC = decode_huffman_symbol(DC_table, reader);
+    if (magnitude_DC < 0 || magnitude_DC > MAX_MAGNITUDE_DC_VALUE) return EXIT_FAILURE;
+    bit_reader_consume(reader, magnitude_DC);
+
+    uint8_t nombre_de_valeurs_decodees = 1;
+    while (nombre_de_valeurs_decodees < NB_OF_COEFF_IN_8x8_BLOCK) {
+        bit_reader_refill(reader);
+
+        const struct ACFastEntry *fast_entry = &AC_fast_entries[bit_reader_peek(reader, AC_FAST_BITS)];
+        if (fast_entry->length != 0) {
+            bit_reader_consume(reader, fast_entry->length);
+            nombre_de_valeurs_decodees += fast_entry->run;
+            if (nombre_de_valeurs_decodees >= NB_OF_COEFF_IN_8x8_BLOCK) return EXIT_FAILURE;
+            nombre_de_valeurs_decodees++;
+            continue;
         }
 
-        // On prévoit le cas où on a atteint la fin du bitstream sans avoir trouvé les 64 valeurs du MCU en cours de décodage
-            if (nombre_de_valeurs_decodees < NB_OF_COEFF_IN_8x8_BLOCK && *current_pos == bitstream_size_in_bits) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | not enough DC values for current MCU #%ld\n"), MCU_number);
-                return EXIT_FAILURE;
-            }
+        int16_t run_and_size = decode_huffman_symbol(AC_table, reader);
+        if (run_and_size < 0) return EXIT_FAILURE;
+        if (run_and_size == EOB) break;
+        if (run_and_size == ZRL) {
+            if (nombre_de_valeurs_decodees + 16 > NB_OF_COEFF_IN_8x8_BLOCK) return EXIT_FAILURE;
+            nombre_de_valeurs_decodees += 16;
+            continue;
+        }
+        uint8_t magnitude_AC = run_and_size & 0x0F;
+        if (magnitude_AC > MAX_MAGNITUDE_AC_VALUE || magnitude_AC < MIN_MAGNITUDE_AC_VALUE) return EXIT_FAILURE;
+        nombre_de_valeurs_decodees += run_and_size >> 4;
+        if (nombre_de_valeurs_decodees >= NB_OF_COEFF_IN_8x8_BLOCK) return EXIT_FAILURE;
+        bit_reader_consume(reader, magnitude_AC);
+        nombre_de_valeurs_decodees++;
     }
 
-    // On décode pour trouver les 63 valeurs des coefficients AC
-    while(nombre_de_valeurs_decodees < NB_OF_COEFF_IN_8x8_BLOCK && *current_pos < bitstream_size_in_bits){
-        for (size_t i = *current_pos; i < bitstream_size_in_bits; i++) {
-            getHighlyVerbose() ? fprintf(stderr, "\t\t\t\tcurrent_pos = %ld\n", *current_pos):0;
-            // (1) On lit le code de Huffman
-            // On détermine le bit actuel en inspectant l'octet approprié dans bitstream
-            // puis en décalant et en masquant le bit approprié
-            unsigned char current_bit = (bitstream[(size_t)(i / 8)] >> (7 - (i % 8))) & 1;
-
-            if (!current_node) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU()\n"));
-                return EXIT_FAILURE;
-            }
+    return bit_reader_overrun(reader) ? EXIT_FAILURE : EXIT_SUCCESS;
+}
 
-            // On parcours l'arbre de Huffman à la recherche d'un mot de code
-            current_node = (current_bit == 1) ? current_node->right : current_node->left;
 
-            // On détecte une erreur éventuelle d'encodage
-            if (!current_node) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU()\n"));
-                return EXIT_FAILURE;
+//**********************************************************************************************************************
+// Décode les MCUs d'indice first_MCU à last_MCU (exclu), dans l'ordre du bitstream, à partir du lecteur de bits
+int8_t decode_MCUs_range(struct JPEG *jpeg, size_t first_MCU, size_t last_MCU, struct BitReader *reader, int16_t *previous_DC_values, bool dequantize_DC){
+    size_t nb_MCUs_per_line = (get_JPEG_nb_Mcu_Width_Strechted(jpeg) + get_JPEG_Sampling_Factor_X(jpeg) - 1) / get_JPEG_Sampling_Factor_X(jpeg);
+
+    for (size_t MCU_index = first_MCU; MCU_index < last_MCU; MCU_index++) {
+        size_t y = (MCU_index / nb_MCUs_per_line) * get_JPEG_Sampling_Factor_Y(jpeg);
+        size_t x = (MCU_index % nb_MCUs_per_line) * get_JPEG_Sampling_Factor_X(jpeg);
+
+        // On parcours toutes les composantes
+        for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
+            for (int8_t v = 0; v < get_sampling_factor_y(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); v++) {
+                for (int8_t h = 0; h < get_sampling_factor_x(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); h++) {
+                    if (decode_MCU(jpeg, (y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h), i, &previous_DC_values[i], reader, dequantize_DC)) {
+                        return EXIT_FAILURE;
+                    }
+                }
             }
+        }
+    }
+    return EXIT_SUCCESS;
+}
 
-            // On est sur une feuille
-            if (!current_node->left && !current_node->right) {
-                // (2) On récupère le Run/Size associé pour déterminer :
-                // >>> 4 MSB : combien de coefficients nuls précèdent ce coefficient AC
-                // >>> 4 LSB : la magnitude du coefficient AC (Note: valeur comprise entre 0 et A >>> prévoir vérification de la conformité de la valeur lue)
-                uint8_t run_and_size = current_node->symbol;
-                getHighlyVerbose() ? fprintf(stderr, "\t\t\t\t>>> run_and_size = %x\n", run_and_size):0;
-
-                
-                // (3) On récupère la valeur du coefficient AC à partir du Run/Size
-                if (run_and_size == EOB){   // (3a) On gère le cas spécial EOB
-                    int8_t nombre_de_zero_a_ajouter = NB_OF_COEFF_IN_8x8_BLOCK - nombre_de_valeurs_decodees;
-                    for (int8_t j = 0; j < nombre_de_zero_a_ajouter; j++){
-                        set_value_in_MCU(component, MCU_number, nombre_de_valeurs_decodees++, 0);
-                        getHighlyVerbose() ? fprintf(stderr, "\t\t\t| %hx-%d |\n", 0x0, nombre_de_valeurs_decodees):0;
 
-                    }
-                    // On réaffecte la position courante dans le bitstream pour la suite
-                    *current_pos += 1;
-                    break;  // On a fini de récupérer les valeurs des coefficients AC, on peut passer à la suite
-                } else if (run_and_size == ZRL){   // (3b) On gère le cas spécial ZRL
-                    for (int8_t j = 0; j < 16; j++){
-                        set_value_in_MCU(component, MCU_number, nombre_de_valeurs_decodees++, 0);
-                        getHighlyVerbose() ? fprintf(stderr, "\t\t\t| %hx-%d |\n", 0x0, nombre_de_valeurs_decodees):0;
-
-                        if (nombre_de_valeurs_decodees > NB_OF_COEFF_IN_8x8_BLOCK){
-                            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | RLE exceeded MCU size\n"));
-                            return EXIT_FAILURE;
-                        }
+// Nombre total de MCUs (au sens "groupe de blocs de toutes les composantes") de l'image
+size_t get_nb_MCUs(struct JPEG *jpeg){
+    size_t nb_MCUs_per_line = (get_JPEG_nb_Mcu_Width_Strechted(jpeg) + get_JPEG_Sampling_Factor_X(jpeg) - 1) / get_JPEG_Sampling_Factor_X(jpeg);
+    size_t nb_MCUs_per_column = (get_JPEG_nb_Mcu_Height_Strechted(jpeg) + get_JPEG_Sampling_Factor_Y(jpeg) - 1) / get_JPEG_Sampling_Factor_Y(jpeg);
+    return nb_MCUs_per_line * nb_MCUs_per_column;
+}
 
-                    }
-                    // On réaffecte la position courante dans le bitstream pour la suite
-                    *current_pos += 1;
-                } else {    // (3c) Sinon On ajoute le bon nombre de coefficients nuls avant le coefficient AC
-                    uint8_t nb_de_coeff_nuls_a_ajouter_avant = run_and_size >> 4;
-                    for (int8_t j = 0; j < nb_de_coeff_nuls_a_ajouter_avant; j++){
-                        set_value_in_MCU(component, MCU_number, nombre_de_valeurs_decodees++, 0);
-                        getHighlyVerbose() ? fprintf(stderr, "\t\t\t| %hx-%d |\n", 0x0, nombre_de_valeurs_decodees):0;
-                    }
 
-                    // (4) Puis on récupère la magnitude du coefficient AC
-                    uint8_t magnitude_AC = run_and_size & 0x0F; // on récupère les 4 LSB en appliquant un masque
-                    if (magnitude_AC > MAX_MAGNITUDE_AC_VALUE){
-                        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_AC exceeds 15\n"));
-                        return EXIT_FAILURE;
-                    } else if (magnitude_AC < MIN_MAGNITUDE_AC_VALUE){
-                        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | magnitude_AC is negative\n"));
-                        return EXIT_FAILURE;
-                    }
-                    getHighlyVerbose() ? fprintf(stderr, "\t\t\tmagnitude_AC = %x - indice_dans_la_classe_de_magnitude : ", magnitude_AC):0;
-                    int16_t indice_dans_classe_magnitude_AC = 0;
-                    for (uint8_t j = 0; j < magnitude_AC; j++){
-                        indice_dans_classe_magnitude_AC <<= 1;
-                        uint8_t current_bit = (bitstream[(int)((*current_pos + 1 + j) / 8)] >> (7 - ((*current_pos + 1 + j) % 8))) & 1;
-                        indice_dans_classe_magnitude_AC += current_bit;
-                        getHighlyVerbose() ? fprintf(stderr, "%d", current_bit):0;
-                    }
-                    getHighlyVerbose() ? fprintf(stderr, "\n"):0;
+// Décode l'intervalle de restart d'indice interval_index (données comprises entre deux markers RSTn)
+// Chaque intervalle commence sur un octet entier avec des prédicteurs DC nuls : il peut être décodé indépendamment des autres
+int8_t decode_restart_interval(struct JPEG *jpeg, size_t interval_index){
+    size_t restart_interval = get_JPEG_restart_interval(jpeg);
+    size_t nb_MCUs = get_nb_MCUs(jpeg);
+    size_t first_MCU = interval_index * restart_interval;
+    size_t last_MCU = (first_MCU + restart_interval < nb_MCUs) ? first_MCU + restart_interval : nb_MCUs;
 
-                    // (5) On récupère finalement la valeur du coefficient AC à partir de la magnitude et de l'indice dans la classe de magnitude
-                    int16_t AC_value = recover_AC_coeff_value(magnitude_AC, indice_dans_classe_magnitude_AC, jpeg);
-                    set_value_in_MCU(component, MCU_number, nombre_de_valeurs_decodees++, AC_value);
-                    getHighlyVerbose() ? fprintf(stderr, "\t\t\t| %hx-%d | \n", AC_value, nombre_de_valeurs_decodees):0;
+    // Les données de l'intervalle sont délimitées par les markers RSTn (2 octets) qui l'entourent
+    size_t *restart_offsets = get_JPEG_restart_offsets(jpeg);
+    size_t start = (interval_index == 0) ? 0 : restart_offsets[interval_index - 1] + 2;
+    size_t end = (interval_index < get_JPEG_nb_restart_offsets(jpeg)) ? restart_offsets[interval_index] : get_JPEG_image_data_size_in_bits(jpeg) / 8;
 
-                    // On réaffecte la position courante dans le bitstream pour la suite
-                    *current_pos = i + magnitude_AC;
-                    i += magnitude_AC;
+    struct BitReader reader;
+    initialize_bit_reader(&reader, get_JPEG_image_data(jpeg) + start, end - start);
+    int16_t previous_DC_values[3] = {0};    // Les prédicteurs DC repartent de 0 à chaque intervalle
+    return decode_MCUs_range(jpeg, first_MCU, last_MCU, &reader, previous_DC_values, true);
+}
 
-                }
 
-                // On prépare la suite en repositionnant le current_node sur la racine de l'arbre des AC
-                current_node = get_ht_tree(get_JPEG_ht(jpeg, get_AC_huffman_table_id(component)));
-            }
-            *current_pos += 1;
+// Contexte partagé par les threads qui décodent les intervalles de restart
+struct RestartDecoding {
+    struct JPEG *jpeg;
+    size_t nb_intervals;
+    size_t next_interval;   // prochain intervalle à décoder (incrémenté de façon atomique)
+    int8_t status;          // passe à EXIT_FAILURE dès qu'un intervalle est invalide
+};
 
-            if (nombre_de_valeurs_decodees == NB_OF_COEFF_IN_8x8_BLOCK) break; // On a fini de récupérer les valeurs des coefficients AC, on peut passer à la suite
 
-            // On prévoit le cas où on a atteint la fin du bitstream sans avoir trouvé les 64 valeurs du MCU en cours de décodage
-            if (nombre_de_valeurs_decodees < NB_OF_COEFF_IN_8x8_BLOCK && *current_pos == bitstream_size_in_bits +1) {
-                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_MCU() | not enough AC values for current MCU#%ld\n"), MCU_number);
-                exit(EXIT_FAILURE);
-            }
+// Boucle d'un thread : prend le prochain intervalle libre jusqu'à ce qu'il n'y en ait plus
+static void * decode_restart_intervals_worker(void *arg){
+    struct RestartDecoding *decoding = (struct RestartDecoding *) arg;
+    size_t interval_index;
+
+    // Le thread travaille pour le décodeur de l'image (affichage, erreurs)
+    struct DecoderContext *previous_context = getDecoderContext();
+    bindDecoderContext(get_JPEG_context(decoding->jpeg));
+    while ((interval_index = __atomic_fetch_add(&decoding->next_interval, 1, __ATOMIC_RELAXED)) < decoding->nb_intervals) {
+        if (__atomic_load_n(&decoding->status, __ATOMIC_RELAXED) != EXIT_SUCCESS) break;
+        if (decode_restart_interval(decoding->jpeg, interval_index)) {
+            __atomic_store_n(&decoding->status, EXIT_FAILURE, __ATOMIC_RELAXED);
+            break;
         }
     }
-    return EXIT_SUCCESS;
+    bindDecoderContext(previous_context);
+    return NULL;
 }
 
 
 //**********************************************************************************************************************
 // Décode le bitstream et récupère les MCU de chacune des composantes
 int8_t decode_bitstream(struct JPEG * jpeg){
-    
-    int16_t previous_DC_values[3] = {0};    // On initialise le prédicat DC à 0 pour chaque composante (3 composantes max dans notre implémentation)
-
-    size_t current_pos = 0;
-    // On parcourt tous les MCUs de l'image
-    for (size_t y = 0; y < get_JPEG_nb_Mcu_Height_Strechted(jpeg);y+= get_JPEG_Sampling_Factor_Y(jpeg)){
-        for (size_t x = 0; x < get_JPEG_nb_Mcu_Width_Strechted(jpeg); x+= get_JPEG_Sampling_Factor_X(jpeg)) {
-            // Prévoir possibilité de reset-er les données `previous_DC_values` dans le cas où l'on a
-            // plusieurs scans/frames ---> mode progressif
-            
-            // On parcours toutes les composantes
-            for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {   // attention ici l'index 0 correspond au 1er scan/frame ... prévoir d'intégrer un index pour le mode progressif
-                for (int8_t v = 0; v < get_sampling_factor_y(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); v++) {
-                    for (int8_t h = 0; h < get_sampling_factor_x(get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i)); h++) {
-                        if (decode_MCU(jpeg, (y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h), i, &previous_DC_values[i], &current_pos)) {
-                            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_bitstream()\n"));
-                            return EXIT_FAILURE;
-                        }
-                    }
-                }
-            }
-        }   
+
+    size_t nb_MCUs = get_nb_MCUs(jpeg);
+
+    // Sans intervalles de restart, tout le bitstream est décodé d'une traite
+    if (get_JPEG_restart_interval(jpeg) == 0) {
+        struct BitReader reader;
+        initialize_bit_reader(&reader, get_JPEG_image_data(jpeg), get_JPEG_image_data_size_in_bits(jpeg) / 8);
+        int16_t previous_DC_values[3] = {0};    // On initialise le prédicat DC à 0 pour chaque composante (3 composantes max dans notre implémentation)
+        if (decode_MCUs_range(jpeg, 0, nb_MCUs, &reader, previous_DC_values, true)) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_bitstream()\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        set_JPEG_dequantized(jpeg, true);
+        return EXIT_SUCCESS;
+    }
+
+    // Sinon chaque intervalle est délimité par un marker RSTn : il en faut un entre chaque paire d'intervalles
+    struct RestartDecoding decoding = {jpeg, (nb_MCUs + get_JPEG_restart_interval(jpeg) - 1) / get_JPEG_restart_interval(jpeg), 0, EXIT_SUCCESS};
+    if (get_JPEG_nb_restart_offsets(jpeg) + 1 < decoding.nb_intervals) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_bitstream() | missing restart markers\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    // Les intervalles sont répartis dynamiquement entre les threads (le thread courant participe aussi)
+    long nb_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nb_threads = (nb_cpus > 1) ? (size_t) nb_cpus : 1;
+    if (nb_threads > decoding.nb_intervals) nb_threads = decoding.nb_intervals;
+    if (nb_threads > MAX_NB_OF_DECODING_THREADS) nb_threads = MAX_NB_OF_DECODING_THREADS;
+    getVerbose() ? printf("Décodage de %ld intervalles de restart sur %ld thread(s)\n", decoding.nb_intervals, nb_threads):0;
+
+    pthread_t threads[MAX_NB_OF_DECODING_THREADS];
+    size_t nb_started_threads = 0;
+    for (size_t t = 1; t < nb_threads; t++) {
+        if (pthread_create(&threads[nb_started_threads], NULL, decode_restart_intervals_worker, &decoding) != 0) break;   // les threads déjà lancés finiront le travail
+        nb_started_threads++;
+    }
+    decode_restart_intervals_worker(&decoding);
+    for (size_t t = 0; t < nb_started_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+
+    if (decoding.status != EXIT_SUCCESS) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman.c > decode_bitstream()\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
     }
+    set_JPEG_dequantized(jpeg, true);
     return EXIT_SUCCESS;
 }
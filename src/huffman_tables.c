@@ -0,0 +1,116 @@
+#include <utils.h>
+#include <huffman_tables.h>
+
+#define ONE 0x1
+#define SYMBOLS_START_OFFSET_IN_DHT_SEGMENT 16
+#define MAX_MAGNITUDE_AC_VALUE 10
+
+
+//**********************************************************************************************************************
+// Construit la représentation canonique (et la table de lookahead associée) à partir de la table de huffman
+// Aucune allocation : tout est stocké dans les tableaux de taille fixe de canonical et lookup
+// Renvoie EXIT_FAILURE si la table est incohérente (trop de symboles, inégalité de Kraft non respectée)
+int8_t build_huffman_table(unsigned char *ht_data, size_t ht_length, struct HuffmanCanonical *canonical, struct HuffmanLookup *lookup) {
+    getHighlyVerbose() ? fprintf(stderr, "\tHuffman Table :\n"):0;
+    // On vérifie que le pointeur de la table de Huffman existe
+    if (ht_data == NULL || ht_length < SYMBOLS_START_OFFSET_IN_DHT_SEGMENT) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman_tables.c > build_huffman_table()\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    // On vérifie que les longueurs de codes décrivent bien un code préfixe (inégalité de Kraft) :
+    // somme sur les longueurs l de nb_codes(l) * 2^(16 - l) <= 2^16
+    uint32_t kraft_sum = 0;
+    uint16_t nb_symbols = 0;
+    for (uint8_t i = 1; i <= MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; i++) {
+        getHighlyVerbose() ? fprintf(stderr, "\t\tNombre de codes de longueur %d: %d\n", i, ht_data[i - 1]):0;
+        kraft_sum += (uint32_t) ht_data[i - 1] << (MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK - i);
+        nb_symbols += ht_data[i - 1];
+    }
+    if (kraft_sum > (ONE << MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK)) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman_tables.c > build_huffman_table() | too much symbols per level\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+    if (nb_symbols > MAX_HUFFMAN_SYMBOLS || (size_t) (SYMBOLS_START_OFFSET_IN_DHT_SEGMENT + nb_symbols) > ht_length) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - huffman_tables.c > build_huffman_table() | not enough symbols\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    // Par défaut aucun code n'est résolu par la table : on passera par les tableaux canoniques
+    memset(lookup, 0, sizeof(struct HuffmanLookup));
+    memcpy(canonical->huffval, ht_data + SYMBOLS_START_OFFSET_IN_DHT_SEGMENT, nb_symbols);
+
+    // Codes canoniques : les codes d'une même longueur sont consécutifs
+    // >>> maxcode[l]   : plus grand code de longueur l (-1 s'il n'y en a pas)
+    // >>> valoffset[l] : indice dans huffval du symbole du code 'code' de longueur l = valoffset[l] + code
+    uint16_t pos = 0;
+    int32_t code = 0;
+
+    getHighlyVerbose() ? fprintf(stderr, "\t\tSymbol(s): "):0;
+    for (uint8_t i = 1; i <= MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; i++) {
+        uint8_t nb_codes = ht_data[i - 1];
+        if (nb_codes == 0) {
+            canonical->maxcode[i] = -1;
+            canonical->valoffset[i] = 0;
+        } else {
+            canonical->valoffset[i] = pos - code;
+            canonical->maxcode[i] = code + nb_codes - 1;
+        }
+
+        for (uint8_t j = 0; j < nb_codes; j++) {
+            uint8_t symbol = canonical->huffval[pos++];
+            getHighlyVerbose() ? fprintf(stderr, " '%hhx' ", symbol):0;
+
+            // Les codes courts sont recopiés dans la table de lookahead :
+            // toutes les entrées qui commencent par ce code renvoient directement le symbole
+            if (i <= HUFFMAN_LOOKAHEAD_BITS) {
+                uint16_t first = code << (HUFFMAN_LOOKAHEAD_BITS - i);
+                uint16_t nb_entries = ONE << (HUFFMAN_LOOKAHEAD_BITS - i);
+                for (uint16_t e = first; e < first + nb_entries; e++) {
+                    lookup->length[e] = i;
+                    lookup->symbol[e] = symbol;
+                }
+            }
+            code++;
+        }
+        code <<= 1;
+    }
+    getHighlyVerbose() ? fprintf(stderr, "\n"):0;
+    return EXIT_SUCCESS;
+}
+
+
+// Construit la table combinée Run/Size + magnitude d'une table de Huffman AC
+// Pour chaque valeur des AC_FAST_BITS prochains bits, si le code de Huffman ET les bits de magnitude qui le suivent
+// tiennent dans ces AC_FAST_BITS bits, on stocke directement le nombre de zéros, la valeur signée du coefficient
+// et le nombre total de bits à consommer. Les autres entrées (EOB, ZRL, codes ou magnitudes trop longs) restent à 0.
+void build_AC_fast_lookup(unsigned char *ht_data, struct ACFastLookup *AC_fast) {
+    memset(AC_fast, 0, sizeof(struct ACFastLookup));
+    if (ht_data == NULL) return;
+
+    size_t pos = SYMBOLS_START_OFFSET_IN_DHT_SEGMENT;
+    uint16_t code = 0;
+    for (uint8_t length = 1; length <= MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK; length++) {
+        for (uint8_t j = 0; j < ht_data[length - 1]; j++, code++) {
+            uint8_t run_and_size = ht_data[pos++];
+            uint8_t run = run_and_size >> 4;
+            uint8_t magnitude = run_and_size & 0x0F;
+
+            if (magnitude == 0 || magnitude > MAX_MAGNITUDE_AC_VALUE) continue; // EOB, ZRL ou symbole invalide
+            if (length + magnitude > AC_FAST_BITS || code >= (ONE << length)) continue;
+
+            // On énumère toutes les valeurs possibles des bits de magnitude
+            uint8_t total_length = length + magnitude;
+            for (uint16_t indice = 0; indice < (ONE << magnitude); indice++) {
+                uint16_t first = ((code << magnitude) | indice) << (AC_FAST_BITS - total_length);
+                uint16_t nb_entries = ONE << (AC_FAST_BITS - total_length);
+                for (uint16_t e = first; e < first + nb_entries; e++) {
+                    AC_fast->entries[e].value = bit_reader_extend(indice, magnitude);
+                    AC_fast->entries[e].run = run;
+                    AC_fast->entries[e].length = total_length;
+                }
+            }
+        }
+        code <<= 1;
+    }
+}
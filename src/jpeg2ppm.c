@@ -37,19 +37,173 @@ void display_help(char **argv) {
     fprintf(stderr, "\n");
     fprintf(stderr, BLUE("╔══════════════════════════════════════ JPEG DECODER ═══════════════════════════════════════╗\n"));
     fprintf(stderr, BLUE("║\t\t\t\t\t\t\t\t\t\t\t    ║\n"));
-    fprintf(stderr, BLUE("║   Usage: %s [-h] [-v|-hv] [--force-grayscale] <jpeg_file>\t\t\t    ║\n"), argv[0]);
+    fprintf(stderr, BLUE("║   Usage: %s [-h] [-v|-hv] [--force-grayscale] [--speculative] [--probe] [--preview] [--mjpeg|--y4m] [--thumbnail] <jpeg_file> [<jpeg_file>...]  ║\n"), argv[0]);
     fprintf(stderr, BLUE("║\t\t\t\t\t\t\t\t\t\t\t    ║\n"));
     fprintf(stderr, BLUE("║   -h\t\t\thelp\t\t\t\t\t\t\t\t    ║\n"));
     fprintf(stderr, BLUE("║   -v\t\t\tverbose mode\t\t\t\t\t\t\t    ║\n"));
     fprintf(stderr, BLUE("║   -hv\t\t\thighly verbose mode\t\t\t\t\t\t    ║\n"));
     fprintf(stderr, BLUE("║   --force-grayscale\tforce grayscale decoding\t\t\t\t\t    ║\n"));
+    fprintf(stderr, BLUE("║   --speculative\tspeculative parallel huffman decoding (multi-core)\t\t    ║\n"));
+    fprintf(stderr, BLUE("║   --probe\t\tprint the header as one line of JSON (no decoding)\t\t    ║\n"));
+    fprintf(stderr, BLUE("║   --preview\t\tprogressive JPEG: also write a 1/8 preview (<name>.preview.ppm)\t    ║\n"));
+    fprintf(stderr, BLUE("║   --mjpeg\t\tMotion-JPEG stream: write raw RGB24 (or GRAY8) frames to stdout\t    ║\n"));
+    fprintf(stderr, BLUE("║   --y4m\t\tMotion-JPEG stream: write a YUV4MPEG2 (4:4:4) stream to stdout\t    ║\n"));
+    fprintf(stderr, BLUE("║   --thumbnail\t\twrite the Exif thumbnail (or a 1/8 image) to <name>.thumbnail.ppm    ║\n"));
     fprintf(stderr, BLUE("║\t\t\t\t\t\t\t\t\t\t\t    ║\n"));
     fprintf(stderr, BLUE("║   Note: the output file will be saved in the same directory that those of the input file. ║\n"));
+    fprintf(stderr, BLUE("║   Several input files are decoded in one batch, sharing their Huffman/quantization tables ║\n"));
     fprintf(stderr ,BLUE("╚═══════════════════════════════════════════════════════════════════════════════════════════╝\n"));
     fprintf(stderr, "\n");
 }
 
 
+// Écrit un aperçu à 1/8 (cf. struct PreviewCallback) à côté de l'image input_filename, avec le suffixe suffix
+static void write_scaled_image(const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components, const char *input_filename, const char *suffix) {
+    char *output_filename = generate_output_filename(input_filename, suffix, nb_components);
+    if (output_filename == NULL) return;
+    if (write_pnm(output_filename, pixels, width, height, nb_components) == EXIT_SUCCESS) {
+        getVerbose() ? printf("Aperçu %zux%zu écrit dans %s\n", width, height, output_filename):0;
+    }
+    free(output_filename);
+}
+
+
+// Aperçu d'une image progressive (--preview) : écrit à côté de l'image finale dès que tous les coefficients DC sont lus
+static void write_preview(const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components, void *user_data) {
+    write_scaled_image(pixels, width, height, nb_components, (const char *) user_data, ".preview");
+}
+
+
+// Vignette d'une image sans vignette Exif (--thumbnail) : l'aperçu à 1/8 calculé à partir des coefficients DC
+static void write_DC_thumbnail(const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components, void *user_data) {
+    write_scaled_image(pixels, width, height, nb_components, (const char *) user_data, ".thumbnail");
+}
+
+
+// Mode --thumbnail : la vignette JPEG du segment Exif (cf. exif.h) est décodée seule, sans lire l'image principale
+// Sans vignette, l'image est décodée à 1/8 de sa taille à partir des seuls coefficients DC (cf. decode_JPEG_DC_preview())
+static int8_t write_thumbnail(char *filename, bool force_grayscale, bool speculative) {
+
+    struct ByteStream file;
+    if (open_byte_stream(&file, filename, true)) {
+        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > open_byte_stream() | %s\n"), getDecoderStatusName(getDecoderStatus()));
+        return EXIT_FAILURE;
+    }
+
+    const unsigned char *thumbnail;
+    size_t thumbnail_size;
+    int8_t status;
+    if (find_exif_thumbnail(file.data, file.size, &thumbnail, &thumbnail_size)) {
+
+        // La vignette n'a pas d'en-tête JFIF (et parfois pas de DHT) : elle est lue comme une image de flux Motion-JPEG
+        struct JPEG *jpeg = extract_frame(thumbnail, thumbnail_size, NULL, NULL);
+        if (jpeg == NULL) {
+            close_byte_stream(&file);
+            fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > extract_frame() | %s\n"), getDecoderStatusName(getDecoderStatus()));
+            return EXIT_FAILURE;
+        }
+        if ((status = decode_JPEG(jpeg, false, force_grayscale)) == DECODER_OK) {
+            status = write_ppm_with_suffix(filename, ".thumbnail", jpeg, force_grayscale);
+        }
+        getVerbose() ? printf("Vignette Exif %dx%d (%zu octets)\n", get_JPEG_width(jpeg), get_JPEG_height(jpeg), thumbnail_size):0;
+        free_JPEG_struct(jpeg);
+        close_byte_stream(&file);
+
+    } else {
+
+        // Le fichier déjà ouvert est relu en entier (pipe compris) : il reste ouvert tant que la structure JPEG existe
+        struct JPEG *jpeg = extract_mem(file.data, file.size);
+        if (jpeg == NULL) {
+            close_byte_stream(&file);
+            fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > extract() | %s\n"), getDecoderStatusName(getDecoderStatus()));
+            return EXIT_FAILURE;
+        }
+        struct PreviewCallback callback = {write_DC_thumbnail, filename};
+        set_JPEG_preview_callback(jpeg, callback);
+        status = decode_JPEG_DC_preview(jpeg, speculative);
+        free_JPEG_struct(jpeg);
+        close_byte_stream(&file);
+    }
+
+    if (status) {
+        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > write_thumbnail() | %s\n"), getDecoderStatusName(status));
+        return EXIT_FAILURE;
+    }
+    fprintf(stderr, GREEN("Vignette écrite avec succès !\n"));
+    return EXIT_SUCCESS;
+}
+
+
+// Décode (ou analyse, avec --probe) le fichier filename selon les options de la ligne de commande
+// En traitement par lot (batch), un fichier introuvable n'affiche pas l'aide : on passe simplement au suivant
+// Les images sont lues dans la structure de decoder, réutilisée d'un fichier à l'autre (cf. struct JPEGDecoder)
+static int8_t decode_file(char **argv, bool batch, struct JPEGDecoder *decoder, char *filename, bool force_grayscale, bool speculative, bool probe, bool preview, bool mjpeg, bool y4m, bool thumbnail) {
+
+    // Checking if filename placed correctly in command line
+    FILE *input_file = fopen(filename, "r");
+    if (!input_file) {
+        if (!batch) display_help(argv);
+        fprintf(stderr, RED("ERROR : OPEN - jpeg2ppm.c > main() while trying to open %s\n"), filename);
+        return EXIT_FAILURE;
+    }
+    fclose(input_file);
+
+    // Mode --probe : on lit seulement l'en-tête (jusqu'au premier SOS) et on l'affiche en JSON
+    if (probe) {
+        struct JPEG *header = extract_header(filename);
+        if (header == NULL) {
+            fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > extract_header() | %s\n"), getDecoderStatusName(getDecoderStatus()));
+            return EXIT_FAILURE;
+        }
+        int8_t status = write_header_json(stdout, filename, header);
+        free_JPEG_struct(header);
+        return status ? EXIT_FAILURE : EXIT_SUCCESS;
+    }
+
+    // Flux Motion-JPEG : images brutes (--mjpeg) ou flux Y4M (--y4m) sur la sortie standard
+    if (mjpeg || y4m) {
+        int8_t status = decode_mjpeg(filename, stdout, y4m ? FRAME_OUTPUT_Y4M : FRAME_OUTPUT_RAW, speculative, force_grayscale);
+        if (status) {
+            fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > decode_mjpeg() | %s\n"), getDecoderStatusName(status));
+            return EXIT_FAILURE;
+        }
+        return EXIT_SUCCESS;
+    }
+
+    // Mode --thumbnail : vignette Exif, ou image réduite à 1/8
+    if (thumbnail) return write_thumbnail(filename, force_grayscale, speculative);
+
+    struct JPEG *jpeg = JPEG_decoder_extract(decoder, filename);
+    if (jpeg == NULL) {
+        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > extract() | %s\n"), getDecoderStatusName(getDecoderStatus()));
+        return EXIT_FAILURE;
+    }
+
+    int8_t status;
+
+    if (preview) {
+        struct PreviewCallback callback = {write_preview, filename};
+        set_JPEG_preview_callback(jpeg, callback);
+    }
+
+    // Huffman, IQ, IZZ, IDCT, sur-échantillonnage et conversion en RGB
+    if ((status = decode_JPEG(jpeg, speculative, force_grayscale))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > decode_JPEG() | %s\n"), getDecoderStatusName(status));
+        return EXIT_FAILURE;
+    };
+
+    if ((status = write_ppm(filename, jpeg, force_grayscale))) {
+        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > write_ppm() | %s\n"), getDecoderStatusName(status));
+        return EXIT_FAILURE;
+    } else {
+        fprintf(stderr, GREEN("Image décodée avec succès !\n"));
+    }
+
+    // La structure (et ses allocations) reste dans decoder pour le fichier suivant
+    return EXIT_SUCCESS;
+}
+
+
 int main(int argc, char **argv) {
     if (argc == 1) {
     	/* 
@@ -60,8 +214,19 @@ int main(int argc, char **argv) {
     	return EXIT_FAILURE;
     }
 
+    // Contexte du décodeur (affichage, erreurs) utilisé par toutes les étapes
+    struct DecoderContext context;
+    initializeDecoderContext(&context);
+    bindDecoderContext(&context);
+
     // Managing options
     bool force_grayscale = false;
+    bool speculative = false;
+    bool probe = false;
+    bool preview = false;
+    bool mjpeg = false;
+    bool y4m = false;
+    bool thumbnail = false;
     
     if (argc > 2){
         if (optionExists(argc, argv, "-h")){
@@ -81,67 +246,74 @@ int main(int argc, char **argv) {
         if (optionExists(argc, argv, "--force-grayscale")){
             force_grayscale = true;
         }
-    }
 
-    // Checking if filename placed correctly in command line
-    FILE *input_file = fopen(argv[argc - 1], "r");
-    if (!input_file) {
-        display_help(argv);
-        fprintf(stderr, RED("ERROR : OPEN - jpeg2ppm.c > main() while trying to open %s\n"), argv[argc - 1]);
-        return EXIT_FAILURE;
-    }
-    fclose(input_file);
+        if (optionExists(argc, argv, "--speculative")){
+            speculative = true;
+        }
 
-    // Now decoding JPEG
-    char *filename = argv[argc - 1];
+        if (optionExists(argc, argv, "--probe")){
+            probe = true;
+        }
 
-    struct JPEG *jpeg = extract(filename);
-    if (jpeg == NULL) return EXIT_FAILURE;
+        if (optionExists(argc, argv, "--preview")){
+            preview = true;
+        }
 
-    if (decode_bitstream(jpeg)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > decode_bitstream()\n"));
-        return EXIT_FAILURE;
-    };
+        if (optionExists(argc, argv, "--mjpeg")){
+            mjpeg = true;
+        }
 
-    if (IQ(jpeg)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > IQ()\n"));
-        return EXIT_FAILURE;
-    };
+        if (optionExists(argc, argv, "--y4m")){
+            y4m = true;
+        }
 
-    if (IZZ(jpeg)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > IZZ()\n"));
-        return EXIT_FAILURE;
-    };
+        if (optionExists(argc, argv, "--thumbnail")){
+            thumbnail = true;
+        }
+    }
 
-    if (IDCT(jpeg)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > IDCT()\n"));
+    // Fichiers à décoder : tous les arguments qui ne sont pas des options (plusieurs fichiers : traitement par lot,
+    // les tables de Huffman et de quantification communes aux images ne sont construites qu'une fois, cf. table_cache.h)
+    char **filenames = (char **) malloc(argc * sizeof(char *));
+    if (check_memory_allocation((void *) filenames)) return EXIT_FAILURE;
+    int nb_files = 0;
+    for (int i = 1; i < argc; i++) {
+        if (argv[i][0] != '-') filenames[nb_files++] = argv[i];
+    }
+    if (nb_files == 0) {
+        display_help(argv);
+        fprintf(stderr, RED("ERROR : ARGUMENT - jpeg2ppm.c > main() | no input file\n"));
+        free(filenames);
         return EXIT_FAILURE;
-    };
-
-    if (get_JPEG_Sampling_Factor_X(jpeg) != 1 || get_JPEG_Sampling_Factor_Y(jpeg) != 1) {
-        stretch_function(jpeg);
     }
 
-    if (YCbCr2RGB(jpeg, force_grayscale)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > YCbCr2RGB()\n"));
+    // Flux Motion-JPEG : images brutes (--mjpeg) ou flux Y4M (--y4m) sur la sortie standard, un seul flux
+    if ((mjpeg || y4m) && nb_files > 1) {
+        fprintf(stderr, RED("ERROR : ARGUMENT - jpeg2ppm.c > main() | --mjpeg and --y4m take a single input stream\n"));
+        free(filenames);
         return EXIT_FAILURE;
-    };
+    }
 
-    if (write_ppm(filename, jpeg, force_grayscale)) {
-        free_JPEG_struct(jpeg);
-        fprintf(stderr, RED("ERROR : GLOBAL - jpeg2ppm.c > main() > write_ppm()\n"));
+    struct JPEGDecoder *decoder = create_JPEG_decoder();
+    if (decoder == NULL) {
+        free(filenames);
         return EXIT_FAILURE;
-    } else {
-        fprintf(stderr, GREEN("Image décodée avec succès !\n"));
     }
-    
-    // On libère la mémoire
-    free_JPEG_struct(jpeg);
 
-    return EXIT_SUCCESS;
+    int nb_failures = 0;
+    for (int i = 0; i < nb_files; i++) {
+        if (decode_file(argv, nb_files > 1, decoder, filenames[i], force_grayscale, speculative, probe, preview, mjpeg, y4m, thumbnail)) nb_failures++;
+    }
+
+    // Traitement par lot : bilan et efficacité du cache des tables
+    if (nb_files > 1) {
+        struct TableCacheStatistics statistics = get_table_cache_statistics();
+        fprintf(stderr, "%d image(s) sur %d traitée(s) avec succès\n", nb_files - nb_failures, nb_files);
+        fprintf(stderr, "Cache des tables : Huffman %zu hit(s) / %zu miss(es), quantification %zu hit(s) / %zu miss(es)\n",
+                statistics.huffman_hits, statistics.huffman_misses, statistics.quantization_hits, statistics.quantization_misses);
+    }
+
+    free_JPEG_decoder(decoder);
+    free(filenames);
+    return nb_failures ? EXIT_FAILURE : EXIT_SUCCESS;
 }
@@ -0,0 +1,140 @@
+#define _POSIX_C_SOURCE 200809L    // clock_gettime()
+#include <mjpeg.h>
+
+
+// Secondes écoulées depuis une origine fixe (horloge monotone, insensible aux changements d'heure)
+static double get_time_in_seconds() {
+    struct timespec now;
+    clock_gettime(CLOCK_MONOTONIC, &now);
+    return now.tv_sec + now.tv_nsec / 1e9;
+}
+
+
+// Écrit l'image décodée jpeg dans output (pixels est agrandi si besoin, et réutilisé d'une image à l'autre)
+static int8_t write_frame(struct JPEG *jpeg, FILE *output, enum FrameOutputFormat format, uint8_t nb_components,
+                          uint8_t **pixels, size_t *pixels_size) {
+    size_t width = get_JPEG_width(jpeg);
+    size_t height = get_JPEG_height(jpeg);
+    size_t frame_size = width * height * nb_components;
+
+    if (frame_size > *pixels_size) {
+        uint8_t *new_pixels = (uint8_t *) realloc(*pixels, frame_size);
+        if (check_memory_allocation((void *) new_pixels)) return setDecoderError(DECODER_ERROR_MEMORY);
+        *pixels = new_pixels;
+        *pixels_size = frame_size;
+    }
+
+    if (format == FRAME_OUTPUT_Y4M) {
+        // Un plan par composante, à la taille de l'image (la chrominance est déjà sur-échantillonnée)
+        for (int8_t component = 0; component < nb_components; component++) {
+            write_component_plane(jpeg, component, *pixels + component * width * height, width);
+        }
+        if (fputs("FRAME\n", output) == EOF) {
+            fprintf(stderr, RED("ERROR : WRITE - mjpeg.c > write_frame() > FRAME\n"));
+            return setDecoderError(DECODER_ERROR_WRITE);
+        }
+    } else {
+        enum PixelFormat pixel_format = (nb_components == 1) ? PIXEL_FORMAT_GRAY8 : PIXEL_FORMAT_RGB24;
+        write_pixels(jpeg, *pixels, width * nb_components, pixel_format, nb_components == 1);
+    }
+
+    if (fwrite(*pixels, 1, frame_size, output) != frame_size) {
+        fprintf(stderr, RED("ERROR : WRITE - mjpeg.c > write_frame() > pixels\n"));
+        return setDecoderError(DECODER_ERROR_WRITE);
+    }
+    return EXIT_SUCCESS;
+}
+
+
+int8_t decode_mjpeg(const char *filename, FILE *output, enum FrameOutputFormat format, bool speculative, bool force_grayscale) {
+
+    resetDecoderStatus();
+
+    // Le flux entier est accessible en mémoire (projeté, ou lu jusqu'à la fin pour un pipe) : chaque image y est lue sans copie
+    struct ByteStream stream;
+    if (open_byte_stream(&stream, filename, false)) return getDecoderStatus();
+
+    // Dernière image décodée : sa structure (tables comprises) est réutilisée par l'image suivante (cf. extract_frame_into())
+    // >>> pour des images de même taille, le décodage du flux ne fait plus d'allocation après la première image
+    struct JPEG *frame = NULL;
+    uint8_t *pixels = NULL;
+    size_t pixels_size = 0;
+    size_t nb_frames = 0;
+    size_t width = 0, height = 0;           // dimensions (et composantes) de la première image, fixes pour un flux Y4M
+    uint8_t nb_components = 0;
+    int8_t status = DECODER_OK;
+
+    double start = get_time_in_seconds();
+
+    size_t position = 0;
+    while (position < stream.size) {
+        // Début de l'image suivante : marker SOI (on saute ce qui précède)
+        const unsigned char *next = memchr(stream.data + position, SEGMENT_START, stream.size - position);
+        while (next != NULL && !((size_t) (next - stream.data) + 1 < stream.size && next[1] == SOI)) {
+            size_t offset = next - stream.data + 1;
+            next = memchr(stream.data + offset, SEGMENT_START, stream.size - offset);
+        }
+        if (next == NULL) break;
+        position = next - stream.data;
+
+        size_t frame_size = 0;
+        frame = extract_frame_into(frame, stream.data + position, stream.size - position, &frame_size);
+        if (frame == NULL) {
+            status = getDecoderStatus();
+            fprintf(stderr, RED("ERROR : GLOBAL - mjpeg.c > decode_mjpeg() > extract_frame() | frame %zu : %s\n"), nb_frames, getDecoderStatusName(status));
+            break;
+        }
+
+        uint8_t frame_nb_components = force_grayscale ? 1 : get_sof_nb_components(get_JPEG_sof(frame)[0]);
+
+        if (nb_frames == 0) {
+            width = get_JPEG_width(frame);
+            height = get_JPEG_height(frame);
+            nb_components = frame_nb_components;
+            if (format == FRAME_OUTPUT_Y4M && fprintf(output, "YUV4MPEG2 W%zu H%zu F%s Ip A1:1 %s\n", width, height, Y4M_FRAME_RATE, (nb_components == 1) ? "Cmono" : "C444") < 0) {
+                fprintf(stderr, RED("ERROR : WRITE - mjpeg.c > decode_mjpeg() > Y4M header\n"));
+                status = setDecoderError(DECODER_ERROR_WRITE);
+                break;
+            }
+        } else if (format == FRAME_OUTPUT_Y4M && ((size_t) get_JPEG_width(frame) != width || (size_t) get_JPEG_height(frame) != height || frame_nb_components != nb_components)) {
+            // Un flux Y4M garde les dimensions de son en-tête
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - mjpeg.c > decode_mjpeg() | frame %zu is %dx%d, the stream is %zux%zu\n"), nb_frames, get_JPEG_width(frame), get_JPEG_height(frame), width, height);
+            status = setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            break;
+        }
+
+        // Y4M : les composantes Y, Cb, Cr sont écrites telles quelles (pas de conversion en RGB)
+        if (format == FRAME_OUTPUT_Y4M) {
+            status = decode_JPEG_YCbCr(frame, speculative);
+        } else {
+            status = decode_JPEG(frame, speculative, force_grayscale);
+        }
+        if (status == DECODER_OK) status = write_frame(frame, output, format, frame_nb_components, &pixels, &pixels_size);
+        if (status) {
+            fprintf(stderr, RED("ERROR : GLOBAL - mjpeg.c > decode_mjpeg() | frame %zu : %s\n"), nb_frames, getDecoderStatusName(status));
+            break;
+        }
+
+        nb_frames++;
+        position += frame_size;
+    }
+
+    double elapsed = get_time_in_seconds() - start;
+
+    free_JPEG_struct(frame);
+    free(pixels);
+    close_byte_stream(&stream);
+
+    if (fflush(output) == EOF && status == DECODER_OK) {
+        fprintf(stderr, RED("ERROR : WRITE - mjpeg.c > decode_mjpeg() > fflush()\n"));
+        status = setDecoderError(DECODER_ERROR_WRITE);
+    }
+
+    if (status == DECODER_OK && nb_frames == 0) {
+        fprintf(stderr, RED("ERROR : FORMAT - mjpeg.c > decode_mjpeg() | no JPEG frame in %s\n"), filename);
+        return setDecoderError(DECODER_ERROR_FORMAT);
+    }
+
+    fprintf(stderr, "%zu image(s) décodée(s) en %.3f s : %.1f images/s\n", nb_frames, elapsed, (elapsed > 0) ? nb_frames / elapsed : 0.0);
+    return status;
+}
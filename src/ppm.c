@@ -1,13 +1,109 @@
 #include <ppm.h>
 
 
+// Nombre d'octets d'un pixel au format format (0 si le format est inconnu)
+uint8_t get_pixel_format_size(enum PixelFormat format) {
+    switch (format) {
+        case PIXEL_FORMAT_GRAY8:    return 1;
+        case PIXEL_FORMAT_RGB24:
+        case PIXEL_FORMAT_BGR24:    return 3;
+        case PIXEL_FORMAT_RGBA32:
+        case PIXEL_FORMAT_BGRA32:   return 4;
+        default:                    return 0;
+    }
+}
+
+
+// Recopie les pixels décodés dans pixels, ligne par ligne, au format format
+// Les MCUs (8x8) sont parcourus ligne de pixels par ligne de pixels, on ignore ceux qui dépassent de l'image
+void write_pixels(struct JPEG *jpeg, uint8_t *pixels, size_t stride, enum PixelFormat format, bool force_grayscale) {
+
+    bool grayscale = force_grayscale || get_sof_nb_components(get_JPEG_sof(jpeg)[0]) == 1;
+
+    size_t width = get_JPEG_width(jpeg);
+    size_t height = get_JPEG_height(jpeg);
+    size_t nb_mcu_width = get_JPEG_nb_Mcu_Width_Strechted(jpeg);
+    uint8_t pixel_size = get_pixel_format_size(format);
+
+    // Position de R, G et B dans un pixel (BGR : on inverse R et B)
+    bool swap_red_blue = (format == PIXEL_FORMAT_BGR24 || format == PIXEL_FORMAT_BGRA32);
+    uint8_t red_offset = swap_red_blue ? 2 : 0;
+    uint8_t blue_offset = swap_red_blue ? 0 : 2;
+    bool alpha = (pixel_size == 4);
+
+    int16_t** MCUs_component0 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_0_INDEX));
+    int16_t** MCUs_component1 = MCUs_component0;
+    int16_t** MCUs_component2 = MCUs_component0;
+    if (!grayscale) {
+        MCUs_component1 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_1_INDEX));
+        MCUs_component2 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_2_INDEX));
+    }
+
+    for (size_t y = 0; y < height; y++) {
+        uint8_t *line = pixels + y * stride;
+        size_t first_mcu = (y / 8) * nb_mcu_width;
+        size_t line_in_mcu = (y % 8) * 8;
+
+        for (size_t x = 0; x < width; x++) {
+            size_t index_mcu = first_mcu + x / 8;
+            size_t index_pixel = line_in_mcu + x % 8;
+            uint8_t *pixel = line + x * pixel_size;
+
+            if (format == PIXEL_FORMAT_GRAY8) {
+                pixel[0] = MCUs_component0[index_mcu][index_pixel];
+                continue;
+            }
+            pixel[red_offset] = MCUs_component0[index_mcu][index_pixel];
+            pixel[1] = MCUs_component1[index_mcu][index_pixel];
+            pixel[blue_offset] = MCUs_component2[index_mcu][index_pixel];
+            if (alpha) pixel[3] = 255;
+        }
+    }
+}
+
+
+void write_component_plane(struct JPEG *jpeg, int8_t component, uint8_t *plane, size_t stride) {
+
+    size_t width = get_JPEG_width(jpeg);
+    size_t height = get_JPEG_height(jpeg);
+    size_t nb_mcu_width = get_JPEG_nb_Mcu_Width_Strechted(jpeg);
+
+    int16_t** MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), component));
+
+    for (size_t y = 0; y < height; y++) {
+        uint8_t *line = plane + y * stride;
+        int16_t **MCUs_line = MCUs + (y / 8) * nb_mcu_width;
+        size_t line_in_mcu = (y % 8) * 8;
+
+        // Une ligne de bloc (8 pixels) à la fois
+        for (size_t x = 0; x < width; x += 8) {
+            const int16_t *block_line = MCUs_line[x / 8] + line_in_mcu;
+            size_t nb_pixels = (width - x < 8) ? width - x : 8;
+            for (size_t k = 0; k < nb_pixels; k++) {
+                line[x + k] = block_line[k];
+            }
+        }
+    }
+}
+
 
-// Fonction qui génère le nom du fichier de sortie
-char* generate_output_filename(const char *input_filename, uint8_t nb_components) {
+// Fonction qui génère le nom du fichier de sortie : <dossier>/<nom sans extension><suffix>.pgm (ou .ppm)
+// basename() et dirname() peuvent modifier la chaîne : on travaille sur une copie du nom du fichier d'entrée
+char* generate_output_filename(const char *input_filename, const char *suffix, uint8_t nb_components) {
     char *output_filename = malloc(500*sizeof(char)); // Si quelqu'un veut vraiment abuser ...
-    char *base_name = basename((char *) input_filename);
+    char *base_copy = malloc(strlen(input_filename) + 1);
+    char *dir_copy = malloc(strlen(input_filename) + 1);
+    if (output_filename == NULL || base_copy == NULL || dir_copy == NULL) {
+        free(output_filename);
+        free(base_copy);
+        free(dir_copy);
+        return NULL;
+    }
+    strcpy(base_copy, input_filename);
+    strcpy(dir_copy, input_filename);
+    char *base_name = basename(base_copy);
     char *dot = strrchr(base_name, '.');
-    char *dir_name = dirname((char *) input_filename);
+    char *dir_name = dirname(dir_copy);
 
     // copy the directory name to output_filename
     strcpy(output_filename, dir_name);
@@ -20,8 +116,11 @@ char* generate_output_filename(const char *input_filename, uint8_t nb_components
         // if no extension, just copy the whole base name
         strcat(output_filename, base_name);
     }
+    free(base_copy);
+    free(dir_copy);
 
-    // add the new extension
+    // add the suffix and the new extension
+    strcat(output_filename, suffix);
     strcat(output_filename, ".");
 
     strcat(output_filename, "p");
@@ -38,83 +137,64 @@ char* generate_output_filename(const char *input_filename, uint8_t nb_components
 }
 
 
-int8_t write_ppm(const char *input_filename, struct JPEG *jpeg, bool force_grayscale) {
-
-    int8_t nb_components = get_sof_nb_components(get_JPEG_sof(jpeg)[0]);
-    if (force_grayscale) nb_components = 1;
-
-    int16_t width = get_JPEG_width(jpeg);
-    int16_t height = get_JPEG_height(jpeg);
+// Écrit width * height pixels (nb_components octets par pixel : luminance, ou R G B) dans un fichier PGM (P5) ou PPM (P6)
+int8_t write_pnm(const char *output_filename, const uint8_t *pixels, size_t width, size_t height, uint8_t nb_components) {
 
+    if (nb_components != 1 && nb_components != 3) {
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
 
-    // On prépare le fichier de sortie
-    FILE *output_file;
-    char* output_filename = generate_output_filename(input_filename, nb_components);
-
+    // On vérifie que le fichier a bien été créé/ouvert
+    FILE *output_file = fopen(output_filename, "wb");
+    if (!output_file) {
+        fprintf(stderr, RED("ERROR : WRITE - ppm.c > write_pnm() %s\n"), output_filename);
+        return setDecoderError(DECODER_ERROR_WRITE);
+    }
 
-    if (nb_components == 1) {
-        // On vérifie que le fichier a bien été créé/ouvert
-        output_file = fopen(output_filename, "wb");
-        if (!output_file) {
-            fprintf(stderr, RED("ERROR : OPEN - ppm.c > write_ppm() %s\n"), output_filename);
-            return EXIT_FAILURE;
-        }
+    // On écrit l'en-tête du fichier PGM ou PPM, puis les pixels d'un seul bloc
+    fprintf(output_file, "P%c\n%zu %zu\n255\n", (nb_components == 1) ? '5' : '6', width, height);
+    fwrite(pixels, 1, width * height * nb_components, output_file);
 
-        // On écrit l'en-tête du fichier PGM
-        fprintf(output_file, "P5\n%d %d\n255\n", width, height);
+    // On vérifie que tout a bien été écrit (disque plein...)
+    bool write_error = ferror(output_file);
+    if (fclose(output_file) != 0 || write_error) {
+        fprintf(stderr, RED("ERROR : WRITE - ppm.c > write_pnm() %s\n"), output_filename);
+        return setDecoderError(DECODER_ERROR_WRITE);
+    }
+    return EXIT_SUCCESS;
+}
 
 
-    } else if (nb_components == 3) {
-        // On vérifie que le fichier a bien été créé/ouvert
-        output_file = fopen(output_filename, "wb");
-        if (!output_file) {
-            fprintf(stderr, RED("ERROR : OPEN - ppm.c > write_ppm() %s\n"), output_filename);
-            return EXIT_FAILURE;
-        }
+int8_t write_ppm(const char *input_filename, struct JPEG *jpeg, bool force_grayscale) {
+    return write_ppm_with_suffix(input_filename, "", jpeg, force_grayscale);
+}
 
-        // On écrit l'en-tête du fichier PPM
-        fprintf(output_file, "P6\n%d %d\n255\n", width, height);
-        
-    } else {
-        output_file = NULL;     // On ne se retrouvera jamais ici puisque nb_components est forcément égal à 1 ou 3 après vérification 
-        return EXIT_FAILURE;    // dans extract.c > extract()   ........... juste pour virer le warning à la compilation
-    }
-    
 
-    // On récupère les pointeurs vers les MCUs des composantes disponibles
-    int16_t** MCUs_component0 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_0_INDEX));
-    int16_t** MCUs_component1 = NULL;
-    int16_t** MCUs_component2 = NULL;
+int8_t write_ppm_with_suffix(const char *input_filename, const char *suffix, struct JPEG *jpeg, bool force_grayscale) {
 
-    if (nb_components > 1) {
-        MCUs_component1 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_1_INDEX));
-        MCUs_component2 = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), COMPONENT_2_INDEX));
-    }
+    int8_t nb_components = get_sof_nb_components(get_JPEG_sof(jpeg)[0]);
+    if (force_grayscale) nb_components = 1;
 
+    size_t width = get_JPEG_width(jpeg);
+    size_t height = get_JPEG_height(jpeg);
 
-    // On récupère le nombre de mcus en largeur et hauteur
-    size_t nb_mcu_width = get_JPEG_nb_Mcu_Width_Strechted(jpeg);
-    size_t nb_mcu_height = get_JPEG_nb_Mcu_Height_Strechted(jpeg);
-    
-    for (size_t i = 0; i < nb_mcu_height ; i++){
-        for (int8_t l = 0; l < 8; l++) {
-            for (size_t j = 0; j < nb_mcu_width ; j++){
-                for (int8_t k = 0; k < 8; k++){
-                    if (j * 8 + k < (size_t) width && i * 8 + l < (size_t)height) {
-                        fputc(MCUs_component0[j + i * nb_mcu_width][k+l*8], output_file);
-                        if (nb_components > 1) {
-                            fputc(MCUs_component1[j + i * nb_mcu_width][k+l*8], output_file);
-                            fputc(MCUs_component2[j + i * nb_mcu_width][k+l*8], output_file);
-                        }
-                    }
-                    
-                }
-            }
-        }
+    // On prépare le fichier de sortie
+    char* output_filename = generate_output_filename(input_filename, suffix, nb_components);
+    if (check_memory_allocation((void *) output_filename)) return setDecoderError(DECODER_ERROR_MEMORY);
+
+    // On recopie les pixels dans un buffer écrit d'un seul bloc (plutôt qu'octet par octet)
+    enum PixelFormat format = (nb_components == 1) ? PIXEL_FORMAT_GRAY8 : PIXEL_FORMAT_RGB24;
+    size_t stride = width * get_pixel_format_size(format);
+    uint8_t *pixels = (uint8_t *) malloc(stride * height);
+    if (check_memory_allocation((void *) pixels)) {
+        free(output_filename);
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
+    write_pixels(jpeg, pixels, stride, format, force_grayscale);
 
-    fclose(output_file);
+    int8_t status = write_pnm(output_filename, pixels, width, height, nb_components);
+    free(pixels);
+    if (status) fprintf(stderr, RED("ERROR : WRITE - ppm.c > write_ppm() %s\n"), output_filename);
     free(output_filename);
-    return EXIT_SUCCESS;
-
-}
\ No newline at end of file
+    return status;
+}
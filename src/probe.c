@@ -0,0 +1,76 @@
+#include <probe.h>
+
+
+// Écrit la chaîne string entre guillemets, en échappant les caractères spéciaux JSON
+static void write_json_string(FILE *output, const char *string) {
+    fputc('"', output);
+    for (const unsigned char *c = (const unsigned char *) string; *c != '\0'; c++) {
+        if (*c == '"' || *c == '\\') {
+            fputc('\\', output);
+            fputc(*c, output);
+        } else if (*c < 0x20) {
+            fprintf(output, "\\u%04x", *c);
+        } else {
+            fputc(*c, output);
+        }
+    }
+    fputc('"', output);
+}
+
+
+int8_t write_header_json(FILE *output, const char *filename, struct JPEG *jpeg) {
+
+    struct StartOfFrame *sof = get_JPEG_sof(jpeg)[0];
+    struct StartOfScan *sos = get_JPEG_sos(jpeg)[0];
+
+    fprintf(output, "{\"file\":");
+    write_json_string(output, filename);
+    fprintf(output, ",\"width\":%d,\"height\":%d,\"nb_components\":%d", get_JPEG_width(jpeg), get_JPEG_height(jpeg), get_sof_nb_components(sof));
+    fprintf(output, ",\"sampling_factor_x\":%d,\"sampling_factor_y\":%d", get_JPEG_Sampling_Factor_X(jpeg), get_JPEG_Sampling_Factor_Y(jpeg));
+    fprintf(output, ",\"restart_interval\":%u,\"progressive\":%s", get_JPEG_restart_interval(jpeg), get_JPEG_progressive(jpeg) ? "true" : "false");
+
+    // Composantes du Start Of Frame
+    fprintf(output, ",\"components\":[");
+    for (int8_t i = 0; i < get_sof_nb_components(sof); i++) {
+        struct ComponentSOF *component = get_sof_component(get_sof_components(sof), i);
+        fprintf(output, "%s{\"id\":%d,\"sampling_factor_x\":%d,\"sampling_factor_y\":%d,\"quantization_table\":%d}", (i > 0) ? "," : "",
+                get_id(component), get_sampling_factor_x(component), get_sampling_factor_y(component), get_num_quantization_table(component));
+    }
+
+    // Tables de quantification définies
+    fprintf(output, "],\"quantization_tables\":[");
+    bool first = true;
+    for (int8_t i = 0; i < MAX_NUMBER_OF_QUANTIZATION_TABLES; i++) {
+        struct QuantizationTable *qt = get_JPEG_qt(jpeg)[i];
+        if (qt == NULL || !get_qt_set(qt)) continue;
+        fprintf(output, "%s%d", first ? "" : ",", get_qt_id(qt));
+        first = false;
+    }
+
+    // Tables de Huffman définies (16 octets de longueurs de codes puis les symboles)
+    fprintf(output, "],\"huffman_tables\":[");
+    first = true;
+    for (int8_t i = 0; i < MAX_NUMBER_OF_HUFFMAN_TABLES; i++) {
+        struct HuffmanTable *ht = get_JPEG_ht(jpeg, i);
+        if (ht == NULL || !get_ht_set(ht)) continue;
+        size_t nb_symbols = (get_ht_length(ht) > 16) ? get_ht_length(ht) - 16 : 0;
+        fprintf(output, "%s{\"class\":\"%s\",\"destination\":%d,\"nb_symbols\":%zu}", first ? "" : ",",
+                (get_ht_class(ht) == 0) ? "DC" : "AC", get_ht_destination(ht), nb_symbols);
+        first = false;
+    }
+
+    // Composantes du premier scan
+    fprintf(output, "],\"scan\":[");
+    for (int8_t i = 0; i < get_sos_nb_components(sos); i++) {
+        struct ComponentSOS *component = get_sos_component(get_sos_components(sos), i);
+        fprintf(output, "%s{\"id\":%d,\"DC_huffman_table\":%d,\"AC_huffman_table\":%d}", (i > 0) ? "," : "",
+                get_id_table(component), get_DC_huffman_table_id(component), get_AC_huffman_table_id(component) - 2);
+    }
+    fprintf(output, "]}\n");
+
+    if (ferror(output)) {
+        fprintf(stderr, RED("ERROR : WRITE - probe.c > write_header_json()\n"));
+        return setDecoderError(DECODER_ERROR_WRITE);
+    }
+    return EXIT_SUCCESS;
+}
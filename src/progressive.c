@@ -0,0 +1,375 @@
+#include <progressive.h>
+
+#define MAX_MAGNITUDE_DC_VALUE 11
+#define MAX_MAGNITUDE_AC_VALUE 10
+#define ZRL_RUN 15
+
+
+// État du décodage d'un scan (remis à zéro à chaque intervalle de restart)
+struct ScanDecoding {
+    struct ProgressiveScan *scan;
+    struct BitReader reader;
+    int16_t previous_DC_values[3];  // prédicteurs DC de chaque composante du scan
+    uint32_t EOB_run;               // nombre de blocs restant dans la plage de blocs vides en cours
+};
+
+
+// Lit un bit de correction (raffinement) : il peut y en avoir jusqu'à 63 par bloc, on recharge le réservoir au besoin
+static inline uint16_t get_correction_bit(struct BitReader *reader) {
+    if (reader->nb_bits == 0) bit_reader_refill(reader);
+    return bit_reader_get(reader, 1);
+}
+
+
+//**********************************************************************************************************************
+// Premier passage DC : même codage qu'en mode séquentiel, le coefficient est décalé de approximation_low bits
+static int8_t decode_DC_first(struct ScanDecoding *decoding, int8_t component, int16_t *block) {
+    struct BitReader *reader = &decoding->reader;
+
+    bit_reader_refill(reader);
+    int16_t magnitude = decode_huffman_symbol(decoding->scan->DC_tables[component], reader);
+    if (magnitude < 0) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_DC_first() | invalid huffman code\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    } else if (magnitude > MAX_MAGNITUDE_DC_VALUE) {
+        fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_DC_first() | magnitude_DC > MAX_MAGNITUDE_DC_VALUE\n"));
+        return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+    }
+
+    decoding->previous_DC_values[component] += bit_reader_extend(bit_reader_get(reader, magnitude), magnitude);
+    block[0] = (int16_t) (decoding->previous_DC_values[component] * (1 << decoding->scan->approximation_low));
+    return EXIT_SUCCESS;
+}
+
+
+// Raffinement DC : un seul bit, ajouté au coefficient DC
+static void decode_DC_refine(struct ScanDecoding *decoding, int16_t *block) {
+    if (get_correction_bit(&decoding->reader)) {
+        block[0] |= (int16_t) (1 << decoding->scan->approximation_low);
+    }
+}
+
+
+//**********************************************************************************************************************
+// Premier passage AC : coefficients spectral_start..spectral_end du bloc
+// Un symbole EOB de run r (r < 15) termine le bloc et les (2^r - 1 + r bits suivants) blocs suivants de la bande
+static int8_t decode_AC_first(struct ScanDecoding *decoding, int16_t *block) {
+    struct ProgressiveScan *scan = decoding->scan;
+    struct BitReader *reader = &decoding->reader;
+
+    // Bloc compris dans une plage de blocs vides : rien à lire
+    if (decoding->EOB_run > 0) {
+        decoding->EOB_run--;
+        return EXIT_SUCCESS;
+    }
+
+    for (uint8_t k = scan->spectral_start; k <= scan->spectral_end; k++) {
+        bit_reader_refill(reader);
+        int16_t run_and_size = decode_huffman_symbol(scan->AC_tables[0], reader);
+        if (run_and_size < 0) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_first() | invalid huffman code\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        uint8_t run = run_and_size >> 4;
+        uint8_t magnitude = run_and_size & 0x0F;
+
+        if (magnitude == 0) {
+            if (run < ZRL_RUN) {    // EOBRUN : fin de ce bloc et des EOB_run blocs suivants
+                decoding->EOB_run = (1u << run) - 1;
+                if (run != 0) decoding->EOB_run += bit_reader_get(reader, run);
+                break;
+            }
+            k += ZRL_RUN;   // ZRL : 16 coefficients nuls (le 16e avec k++)
+            continue;
+        }
+
+        if (magnitude > MAX_MAGNITUDE_AC_VALUE) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_first() | magnitude_AC exceeds 10\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        k += run;
+        if (k > scan->spectral_end) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_first() | RLE exceeded spectral band\n"));
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+        block[k] = (int16_t) (bit_reader_extend(bit_reader_get(reader, magnitude), magnitude) * (1 << scan->approximation_low));
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// Ajoute le bit de correction lu au coefficient déjà non nul coefficient (dans le sens de son signe)
+static inline void refine_nonzero_coefficient(struct BitReader *reader, int16_t *coefficient, int16_t bit) {
+    if (get_correction_bit(reader) && (*coefficient & bit) == 0) {
+        *coefficient += (*coefficient >= 0) ? bit : -bit;
+    }
+}
+
+
+// Raffinement AC (norme JPEG, annexe G.1.2.3) :
+// >>> chaque symbole donne un nouveau coefficient (+-1 << approximation_low) précédé de run coefficients nuls
+// >>> les coefficients déjà non nuls rencontrés en chemin ne comptent pas dans le run et reçoivent un bit de correction
+// >>> dans une plage de blocs vides (EOBRUN), seuls les coefficients déjà non nuls reçoivent leur bit de correction
+static int8_t decode_AC_refine(struct ScanDecoding *decoding, int16_t *block) {
+    struct ProgressiveScan *scan = decoding->scan;
+    struct BitReader *reader = &decoding->reader;
+    int16_t bit = (int16_t) (1 << scan->approximation_low);
+    uint8_t k = scan->spectral_start;
+
+    if (decoding->EOB_run == 0) {
+        for (; k <= scan->spectral_end; k++) {
+            bit_reader_refill(reader);
+            int16_t run_and_size = decode_huffman_symbol(scan->AC_tables[0], reader);
+            if (run_and_size < 0) {
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_refine() | invalid huffman code\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            }
+            int8_t run = run_and_size >> 4;
+            uint8_t magnitude = run_and_size & 0x0F;
+            int16_t value = 0;
+
+            if (magnitude != 0) {
+                if (magnitude != 1) {   // un nouveau coefficient vaut forcément +-1 dans une passe de raffinement
+                    fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_refine() | magnitude_AC is not 1\n"));
+                    return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+                }
+                value = bit_reader_get(reader, 1) ? bit : -bit;
+            } else if (run < ZRL_RUN) {     // EOBRUN : ce bloc est le premier de la plage
+                decoding->EOB_run = 1u << run;
+                if (run != 0) decoding->EOB_run += bit_reader_get(reader, run);
+                break;
+            }   // sinon ZRL : on passe 16 coefficients nuls
+
+            // On avance jusqu'au (run + 1)-ième coefficient nul en corrigeant les coefficients non nuls rencontrés
+            for (; k <= scan->spectral_end; k++) {
+                if (block[k] != 0) {
+                    refine_nonzero_coefficient(reader, &block[k], bit);
+                } else if (run-- == 0) {
+                    break;
+                }
+            }
+
+            if (value != 0) {
+                if (k > scan->spectral_end) {
+                    fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_AC_refine() | RLE exceeded spectral band\n"));
+                    return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+                }
+                block[k] = value;
+            }
+        }
+    }
+
+    // Bloc de la plage de blocs vides : seulement les bits de correction des coefficients restants
+    if (decoding->EOB_run > 0) {
+        for (; k <= scan->spectral_end; k++) {
+            if (block[k] != 0) refine_nonzero_coefficient(reader, &block[k], bit);
+        }
+        decoding->EOB_run--;
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// Décode la partie du bloc apportée par le scan (component : indice de la composante dans le scan)
+static int8_t decode_progressive_block(struct ScanDecoding *decoding, int8_t component, int16_t *block) {
+    struct ProgressiveScan *scan = decoding->scan;
+
+    if (scan->spectral_start == 0) {
+        if (scan->approximation_high == 0) return decode_DC_first(decoding, component, block);
+        decode_DC_refine(decoding, block);
+        return EXIT_SUCCESS;
+    }
+    if (scan->approximation_high == 0) return decode_AC_first(decoding, block);
+    return decode_AC_refine(decoding, block);
+}
+
+
+//**********************************************************************************************************************
+// Indice (dans les MCUs de la composante) du bloc à la ligne row et la colonne column de la composante component
+// Les blocs sont rangés comme ceux de la luminance : les blocs d'une composante sous-échantillonnée occupent le coin
+// supérieur gauche de chaque MCU (cf. decode_MCUs_range())
+static size_t get_component_block_index(struct JPEG *jpeg, int8_t component, size_t row, size_t column) {
+    struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), component);
+    size_t sampling_factor_x = get_sampling_factor_x(component_sof);
+    size_t sampling_factor_y = get_sampling_factor_y(component_sof);
+
+    size_t y = (row / sampling_factor_y) * get_JPEG_Sampling_Factor_Y(jpeg) + row % sampling_factor_y;
+    size_t x = (column / sampling_factor_x) * get_JPEG_Sampling_Factor_X(jpeg) + column % sampling_factor_x;
+    return y * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + x;
+}
+
+
+// Décode un scan progressif
+// Scan entrelacé (plusieurs composantes, scans DC uniquement) : MCUs complets comme en mode séquentiel
+// Scan d'une seule composante : les blocs de la composante un par un, ligne par ligne (sans les blocs de remplissage des MCUs)
+static int8_t decode_scan(struct JPEG *jpeg, struct ProgressiveScan *scan) {
+    struct ScanDecoding decoding;
+    decoding.scan = scan;
+    decoding.EOB_run = 0;
+    memset(decoding.previous_DC_values, 0, sizeof(decoding.previous_DC_values));
+
+    bool interleaved = (scan->nb_components > 1);
+    size_t nb_units_per_line;
+    size_t nb_units;
+    if (interleaved) {
+        nb_units_per_line = (get_JPEG_nb_Mcu_Width_Strechted(jpeg) + get_JPEG_Sampling_Factor_X(jpeg) - 1) / get_JPEG_Sampling_Factor_X(jpeg);
+        nb_units = get_nb_MCUs(jpeg);
+    } else {
+        struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), scan->component_indices[0]);
+        size_t width = ((size_t) get_JPEG_width(jpeg) * get_sampling_factor_x(component_sof) + get_JPEG_Sampling_Factor_X(jpeg) - 1) / get_JPEG_Sampling_Factor_X(jpeg);
+        size_t height = ((size_t) get_JPEG_height(jpeg) * get_sampling_factor_y(component_sof) + get_JPEG_Sampling_Factor_Y(jpeg) - 1) / get_JPEG_Sampling_Factor_Y(jpeg);
+        nb_units_per_line = (width + 7) / 8;
+        nb_units = nb_units_per_line * ((height + 7) / 8);
+    }
+
+    // Premier intervalle de restart (ou tout le scan) : jusqu'au premier marker RSTn
+    size_t interval_index = 0;
+    initialize_bit_reader(&decoding.reader, scan->data, (scan->nb_restart_offsets > 0) ? scan->restart_offsets[0] : scan->size);
+
+    for (size_t unit = 0; unit < nb_units; unit++) {
+
+        // Nouvel intervalle de restart : il commence après le marker RSTn, prédicteurs DC et EOBRUN repartent de 0
+        if (scan->restart_interval != 0 && unit != 0 && unit % scan->restart_interval == 0) {
+            interval_index++;
+            if (interval_index > scan->nb_restart_offsets) {
+                fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_scan() | missing restart markers\n"));
+                return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+            }
+            size_t start = scan->restart_offsets[interval_index - 1] + 2;
+            size_t end = (interval_index < scan->nb_restart_offsets) ? scan->restart_offsets[interval_index] : scan->size;
+            initialize_bit_reader(&decoding.reader, scan->data + start, end - start);
+            memset(decoding.previous_DC_values, 0, sizeof(decoding.previous_DC_values));
+            decoding.EOB_run = 0;
+        }
+
+        size_t row = unit / nb_units_per_line;
+        size_t column = unit % nb_units_per_line;
+        if (interleaved) {
+            for (int8_t i = 0; i < scan->nb_components; i++) {
+                int8_t component = scan->component_indices[i];
+                struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), component);
+                int16_t **MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), component));
+                for (int8_t v = 0; v < get_sampling_factor_y(component_sof); v++) {
+                    for (int8_t h = 0; h < get_sampling_factor_x(component_sof); h++) {
+                        size_t index = get_component_block_index(jpeg, component, row * get_sampling_factor_y(component_sof) + v, column * get_sampling_factor_x(component_sof) + h);
+                        if (decode_progressive_block(&decoding, i, MCUs[index])) return EXIT_FAILURE;
+                    }
+                }
+            }
+        } else {
+            int8_t component = scan->component_indices[0];
+            int16_t **MCUs = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), component));
+            if (decode_progressive_block(&decoding, 0, MCUs[get_component_block_index(jpeg, component, row, column)])) return EXIT_FAILURE;
+        }
+
+        if (bit_reader_overrun(&decoding.reader)) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_scan() | not enough values for current MCU#%ld\n"), unit);
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+
+//**********************************************************************************************************************
+// Aperçu à 1/8 de la taille de l'image : un pixel par bloc de luminance, calculé à partir du seul coefficient DC
+// (la moyenne du bloc vaut DC * q[0] / 8 + 128), puis converti en RGB
+int8_t emit_DC_preview(struct JPEG *jpeg) {
+    struct PreviewCallback preview = get_JPEG_preview_callback(jpeg);
+    struct StartOfFrame *sof = get_JPEG_sof(jpeg)[0];
+    int8_t nb_components = get_sof_nb_components(sof);
+    size_t width = get_JPEG_nb_Mcu_Width(jpeg);
+    size_t height = get_JPEG_nb_Mcu_Height(jpeg);
+    size_t sampling_factor_x = get_JPEG_Sampling_Factor_X(jpeg);
+    size_t sampling_factor_y = get_JPEG_Sampling_Factor_Y(jpeg);
+
+    uint8_t *pixels = (uint8_t *) malloc(width * height * nb_components);
+    if (check_memory_allocation((void *) pixels)) return setDecoderError(DECODER_ERROR_MEMORY);
+
+    for (size_t y = 0; y < height; y++) {
+        for (size_t x = 0; x < width; x++) {
+            int16_t levels[3] = {0};
+            for (int8_t i = 0; i < nb_components; i++) {
+                struct ComponentSOF *component_sof = get_sof_component(get_sof_components(sof), i);
+                // Image séquentielle : decode_MCU() a déjà déquantifié le coefficient DC
+                uint16_t DC_quantization = get_JPEG_dequantized(jpeg) ? 1 : get_qt_dequantization(get_JPEG_qt(jpeg)[get_num_quantization_table(component_sof)])[DC_VALUE_INDEX];
+
+                // Bloc de la composante qui couvre le bloc de luminance (y, x)
+                size_t row = (y / sampling_factor_y) * get_sampling_factor_y(component_sof) + (y % sampling_factor_y) * get_sampling_factor_y(component_sof) / sampling_factor_y;
+                size_t column = (x / sampling_factor_x) * get_sampling_factor_x(component_sof) + (x % sampling_factor_x) * get_sampling_factor_x(component_sof) / sampling_factor_x;
+                int16_t *block = get_MCUs(get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i))[get_component_block_index(jpeg, i, row, column)];
+
+                int32_t level = 128 + ((block[DC_VALUE_INDEX] * (int32_t) DC_quantization + 4) >> 3);
+                levels[i] = (level < 0) ? 0 : (level > 255) ? 255 : level;
+            }
+            pixel_YCbCr2RGB(&levels[0], &levels[1], &levels[2], nb_components, false);
+
+            uint8_t *pixel = pixels + (y * width + x) * nb_components;
+            for (int8_t i = 0; i < nb_components; i++) {
+                pixel[i] = levels[i];
+            }
+        }
+    }
+
+    preview.function(pixels, width, height, nb_components, preview.user_data);
+    free(pixels);
+    return EXIT_SUCCESS;
+}
+
+
+// Met à jour les informations (nb_nonzero, last_nonzero) de chaque bloc une fois tous les scans décodés
+static void update_blocks_info(struct JPEG *jpeg) {
+    for (int8_t i = 0; i < get_sos_nb_components(get_JPEG_sos(jpeg)[0]); i++) {
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        int16_t **MCUs = get_MCUs(component);
+        struct BlockInfo *blocks_info = get_blocks_info(component);
+        size_t nb_blocks = get_JPEG_nb_Mcu_Width_Strechted(jpeg) * get_JPEG_nb_Mcu_Height_Strechted(jpeg);
+
+        for (size_t b = 0; b < nb_blocks; b++) {
+            uint8_t nb_nonzero = 0;
+            uint8_t last_nonzero = 0;
+            for (uint8_t k = 0; k < NB_VALUES_IN_8x8_BLOCK; k++) {
+                if (MCUs[b][k] != 0) {
+                    nb_nonzero++;
+                    last_nonzero = k;
+                }
+            }
+            blocks_info[b].nb_nonzero = nb_nonzero;
+            blocks_info[b].last_nonzero = last_nonzero;
+        }
+    }
+}
+
+
+//**********************************************************************************************************************
+int8_t decode_progressive(struct JPEG *jpeg) {
+
+    bool DC_decoded[3] = {false, false, false};    // premier passage DC terminé pour chaque composante
+    bool preview_done = (get_JPEG_preview_callback(jpeg).function == NULL);
+    int8_t nb_components = get_sof_nb_components(get_JPEG_sof(jpeg)[0]);
+
+    for (size_t s = 0; s < get_JPEG_nb_scans(jpeg); s++) {
+        struct ProgressiveScan *scan = &get_JPEG_scans(jpeg)[s];
+        getVerbose() ? printf("Scan progressif #%ld : %d composante(s), coefficients %d..%d, approximation %d -> %d\n", s,
+                              scan->nb_components, scan->spectral_start, scan->spectral_end, scan->approximation_high, scan->approximation_low):0;
+
+        if (decode_scan(jpeg, scan)) {
+            fprintf(stderr, RED("ERROR : INCONSISTENT DATA - progressive.c > decode_progressive() | scan #%ld\n"), s);
+            return setDecoderError(DECODER_ERROR_INCONSISTENT_DATA);
+        }
+
+        // Aperçu dès que le DC de chaque composante est connu (en général après le premier scan)
+        if (scan->spectral_start == 0 && scan->approximation_high == 0) {
+            for (int8_t i = 0; i < scan->nb_components; i++) {
+                DC_decoded[scan->component_indices[i]] = true;
+            }
+        }
+        if (!preview_done && DC_decoded[0] && (nb_components == 1 || (DC_decoded[1] && DC_decoded[2]))) {
+            if (emit_DC_preview(jpeg)) return setDecoderError(DECODER_ERROR_MEMORY);
+            preview_done = true;
+        }
+    }
+
+    update_blocks_info(jpeg);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,376 @@
+#define _POSIX_C_SOURCE 200809L    // sysconf()
+
+#include <string.h>
+#include <unistd.h>
+#include <pthread.h>
+
+#include <speculative.h>
+
+
+//**********************************************************************************************************************
+// Un morceau du bitstream et ce que les différentes phases en ont appris
+struct SpeculativeChunk {
+    size_t start_bit;           // début du morceau (position arbitraire, pas forcément un début de MCU)
+    size_t end_bit;             // fin du morceau (exclue)
+
+    // (1) parcours spéculatif
+    size_t *boundaries;         // positions (croissantes) des débuts de MCU trouvés dans [start_bit, end_bit)
+    size_t nb_boundaries;
+    size_t boundaries_size;     // taille allouée de boundaries
+    size_t exit_position;       // premier début de MCU >= end_bit
+    bool scan_ok;               // false si le parcours a rencontré des données invalides
+
+    // (2) resynchronisation avec les morceaux suivants
+    bool sync_ok;
+    size_t sync_chunk;          // morceau sur lequel on retombe
+    size_t sync_position;       // début de MCU commun aux deux parcours
+    size_t nb_extra_MCUs;       // nombre de MCUs parcourus entre exit_position et sync_position
+};
+
+// Un morceau retenu après recollage : son décodage est exact
+struct DecodingSegment {
+    size_t start_bit;           // vrai début de MCU
+    size_t first_MCU;           // indice du premier MCU du segment
+    size_t nb_MCUs;
+    int16_t DC_values[3];       // prédicteurs DC en fin de segment (en partant de 0) puis décalage DC à appliquer
+    int8_t status;
+};
+
+struct SpeculativeDecoding {
+    struct JPEG *jpeg;
+    const unsigned char *data;
+    size_t data_size;           // en octets
+    int8_t nb_components;
+    struct HuffmanTable *DC_tables[3];
+    struct HuffmanTable *AC_tables[3];
+    uint8_t nb_blocks[3];       // nombre de blocs de chaque composante dans un MCU
+
+    struct SpeculativeChunk chunks[SPECULATIVE_MAX_NB_OF_CHUNKS];
+    size_t nb_chunks;
+    struct DecodingSegment segments[SPECULATIVE_MAX_NB_OF_CHUNKS];
+    size_t nb_segments;
+};
+
+
+//**********************************************************************************************************************
+// Parcourt un MCU complet (tous les blocs de toutes les composantes) sans l'enregistrer
+static int8_t skip_MCU(struct SpeculativeDecoding *decoding, struct BitReader *reader){
+    for (int8_t i = 0; i < decoding->nb_components; i++) {
+        for (uint8_t b = 0; b < decoding->nb_blocks[i]; b++) {
+            if (skip_block(decoding->DC_tables[i], decoding->AC_tables[i], reader)) return EXIT_FAILURE;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// Indique si position fait partie des débuts de MCU trouvés dans le morceau (recherche dichotomique)
+// Renvoie l'indice correspondant dans boundaries, ou nb_boundaries s'il n'y est pas
+static size_t find_boundary(struct SpeculativeChunk *chunk, size_t position){
+    size_t low = 0, high = chunk->nb_boundaries;
+    while (low < high) {
+        size_t middle = low + (high - low) / 2;
+        if (chunk->boundaries[middle] < position) low = middle + 1;
+        else high = middle;
+    }
+    return (low < chunk->nb_boundaries && chunk->boundaries[low] == position) ? low : chunk->nb_boundaries;
+}
+
+
+// (1) Parcours spéculatif d'un morceau : on fait comme si start_bit était un début de MCU
+static void scan_chunk(struct SpeculativeDecoding *decoding, size_t chunk_index){
+    struct SpeculativeChunk *chunk = &decoding->chunks[chunk_index];
+    struct BitReader reader;
+    initialize_bit_reader(&reader, decoding->data, decoding->data_size);
+    bit_reader_seek(&reader, chunk->start_bit);
+
+    size_t position = chunk->start_bit;
+    chunk->scan_ok = true;
+    while (position < chunk->end_bit) {
+        if (chunk->nb_boundaries >= chunk->boundaries_size) {
+            size_t *boundaries = realloc(chunk->boundaries, 2 * chunk->boundaries_size * sizeof(size_t));
+            if (boundaries == NULL) {
+                chunk->scan_ok = false;
+                break;
+            }
+            chunk->boundaries = boundaries;
+            chunk->boundaries_size *= 2;
+        }
+        chunk->boundaries[chunk->nb_boundaries++] = position;
+
+        if (skip_MCU(decoding, &reader)) {
+            chunk->scan_ok = false;
+            break;
+        }
+        position = get_bit_reader_position(&reader);
+    }
+    chunk->exit_position = position;
+}
+
+
+// (2) Resynchronisation : on repart de la sortie (exacte si le morceau l'est) et on avance MCU par MCU
+// jusqu'à retomber sur un début de MCU noté par le parcours spéculatif d'un morceau suivant
+static void synchronize_chunk(struct SpeculativeDecoding *decoding, size_t chunk_index){
+    struct SpeculativeChunk *chunk = &decoding->chunks[chunk_index];
+    chunk->sync_ok = false;
+    if (!chunk->scan_ok) return;
+
+    struct BitReader reader;
+    initialize_bit_reader(&reader, decoding->data, decoding->data_size);
+    bit_reader_seek(&reader, chunk->exit_position);
+
+    size_t position = chunk->exit_position;
+    size_t next_chunk = chunk_index + 1;
+    size_t nb_extra_MCUs = 0;
+    while (true) {
+        while (next_chunk < decoding->nb_chunks && position >= decoding->chunks[next_chunk].end_bit) next_chunk++;
+        if (next_chunk >= decoding->nb_chunks) return;  // ne devrait pas arriver : la fin des données est dans le dernier morceau
+        if (find_boundary(&decoding->chunks[next_chunk], position) < decoding->chunks[next_chunk].nb_boundaries) {
+            chunk->sync_ok = true;
+            chunk->sync_chunk = next_chunk;
+            chunk->sync_position = position;
+            chunk->nb_extra_MCUs = nb_extra_MCUs;
+            return;
+        }
+        if (skip_MCU(decoding, &reader)) return;
+        position = get_bit_reader_position(&reader);
+        nb_extra_MCUs++;
+    }
+}
+
+
+// (3) Recollage : à partir du début (exact) du bitstream, on enchaîne les morceaux resynchronisés
+static int8_t stitch_chunks(struct SpeculativeDecoding *decoding){
+    size_t nb_MCUs = get_nb_MCUs(decoding->jpeg);
+    size_t chunk_index = 0;
+    size_t start_bit = 0;
+    size_t first_MCU = 0;
+    decoding->nb_segments = 0;
+
+    while (first_MCU < nb_MCUs) {
+        struct SpeculativeChunk *chunk = &decoding->chunks[chunk_index];
+        size_t boundary_index = find_boundary(chunk, start_bit);
+        if (boundary_index >= chunk->nb_boundaries) return EXIT_FAILURE;
+
+        // Le dernier morceau va jusqu'à la fin des données, les autres jusqu'au point de resynchronisation
+        bool last_chunk = (chunk_index == decoding->nb_chunks - 1);
+        if (!last_chunk && (!chunk->scan_ok || !chunk->sync_ok)) return EXIT_FAILURE;
+        size_t nb_available_MCUs = chunk->nb_boundaries - boundary_index + (last_chunk ? 0 : chunk->nb_extra_MCUs);
+
+        struct DecodingSegment *segment = &decoding->segments[decoding->nb_segments++];
+        segment->start_bit = start_bit;
+        segment->first_MCU = first_MCU;
+        segment->nb_MCUs = (nb_available_MCUs < nb_MCUs - first_MCU) ? nb_available_MCUs : nb_MCUs - first_MCU;
+        first_MCU += segment->nb_MCUs;
+
+        if (first_MCU < nb_MCUs) {
+            if (last_chunk) return EXIT_FAILURE;    // pas assez de MCUs dans le bitstream
+            start_bit = chunk->sync_position;
+            chunk_index = chunk->sync_chunk;
+        }
+    }
+    return EXIT_SUCCESS;
+}
+
+
+// (4) Décodage exact d'un segment, avec des prédicteurs DC nuls au départ
+static void decode_segment(struct SpeculativeDecoding *decoding, size_t segment_index){
+    struct DecodingSegment *segment = &decoding->segments[segment_index];
+    struct BitReader reader;
+    initialize_bit_reader(&reader, decoding->data, decoding->data_size);
+    bit_reader_seek(&reader, segment->start_bit);
+
+    memset(segment->DC_values, 0, sizeof(segment->DC_values));
+    segment->status = decode_MCUs_range(decoding->jpeg, segment->first_MCU, segment->first_MCU + segment->nb_MCUs, &reader, segment->DC_values, false);
+
+    // Le segment doit se terminer exactement là où commence le suivant
+    if (segment->status == EXIT_SUCCESS && segment_index + 1 < decoding->nb_segments
+        && get_bit_reader_position(&reader) != decoding->segments[segment_index + 1].start_bit) {
+        segment->status = EXIT_FAILURE;
+    }
+}
+
+
+// (5) Correction des coefficients DC d'un segment par le décalage de ses prédicteurs
+// decode_segment() a laissé les DC bruts (les AC sont déjà déquantifiés) : on les déquantifie une fois corrigés
+static void fix_segment_DC(struct SpeculativeDecoding *decoding, size_t segment_index){
+    struct DecodingSegment *segment = &decoding->segments[segment_index];
+    struct JPEG *jpeg = decoding->jpeg;
+    size_t nb_MCUs_per_line = (get_JPEG_nb_Mcu_Width_Strechted(jpeg) + get_JPEG_Sampling_Factor_X(jpeg) - 1) / get_JPEG_Sampling_Factor_X(jpeg);
+
+    for (int8_t i = 0; i < decoding->nb_components; i++) {
+        int16_t DC_offset = segment->DC_values[i];
+
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i);
+        int16_t **MCUs = get_MCUs(component);
+        struct BlockInfo *blocks_info = get_blocks_info(component);
+        int8_t sampling_factor_x = get_sampling_factor_x(component_sof);
+        int8_t sampling_factor_y = get_sampling_factor_y(component_sof);
+        uint16_t DC_quantization = get_qt_dequantization(get_JPEG_qt(jpeg)[get_num_quantization_table(component_sof)])[DC_VALUE_INDEX];
+
+        for (size_t MCU_index = segment->first_MCU; MCU_index < segment->first_MCU + segment->nb_MCUs; MCU_index++) {
+            size_t y = (MCU_index / nb_MCUs_per_line) * get_JPEG_Sampling_Factor_Y(jpeg);
+            size_t x = (MCU_index % nb_MCUs_per_line) * get_JPEG_Sampling_Factor_X(jpeg);
+            for (int8_t v = 0; v < sampling_factor_y; v++) {
+                for (int8_t h = 0; h < sampling_factor_x; h++) {
+                    size_t index = (y + v) * get_JPEG_nb_Mcu_Width_Strechted(jpeg) + (x + h);
+                    int16_t old_DC = MCUs[index][DC_VALUE_INDEX];
+                    int16_t new_DC = old_DC + DC_offset;
+                    MCUs[index][DC_VALUE_INDEX] = dequantize_coefficient(new_DC, DC_quantization);
+                    blocks_info[index].nb_nonzero += (new_DC != 0) - (old_DC != 0);
+                }
+            }
+        }
+    }
+}
+
+
+//**********************************************************************************************************************
+// Répartition d'une phase entre les threads : chacun prend la prochaine tâche libre
+struct SpeculativeTasks {
+    struct SpeculativeDecoding *decoding;
+    void (*task)(struct SpeculativeDecoding *decoding, size_t task_index);
+    size_t nb_tasks;
+    size_t next_task;   // incrémenté de façon atomique
+};
+
+static void * speculative_worker(void *arg){
+    struct SpeculativeTasks *tasks = (struct SpeculativeTasks *) arg;
+    size_t task_index;
+
+    // Le thread travaille pour le décodeur de l'image (affichage, erreurs)
+    struct DecoderContext *previous_context = getDecoderContext();
+    bindDecoderContext(get_JPEG_context(tasks->decoding->jpeg));
+    while ((task_index = __atomic_fetch_add(&tasks->next_task, 1, __ATOMIC_RELAXED)) < tasks->nb_tasks) {
+        tasks->task(tasks->decoding, task_index);
+    }
+    bindDecoderContext(previous_context);
+    return NULL;
+}
+
+static void run_in_parallel(struct SpeculativeDecoding *decoding, void (*task)(struct SpeculativeDecoding *, size_t), size_t nb_tasks){
+    struct SpeculativeTasks tasks = {decoding, task, nb_tasks, 0};
+    pthread_t threads[SPECULATIVE_MAX_NB_OF_CHUNKS];
+    size_t nb_started_threads = 0;
+    for (size_t t = 1; t < nb_tasks; t++) {
+        if (pthread_create(&threads[nb_started_threads], NULL, speculative_worker, &tasks) != 0) break;    // le thread courant finira le travail
+        nb_started_threads++;
+    }
+    speculative_worker(&tasks);
+    for (size_t t = 0; t < nb_started_threads; t++) {
+        pthread_join(threads[t], NULL);
+    }
+}
+
+
+static void free_chunks(struct SpeculativeDecoding *decoding){
+    for (size_t k = 0; k < decoding->nb_chunks; k++) {
+        free(decoding->chunks[k].boundaries);
+    }
+}
+
+
+//**********************************************************************************************************************
+// Décodage de Huffman parallèle spéculatif
+int8_t decode_bitstream_speculative(struct JPEG *jpeg){
+
+    // Un morceau par coeur, sans descendre sous SPECULATIVE_MIN_CHUNK_SIZE octets par morceau
+    size_t data_size = get_JPEG_image_data_size_in_bits(jpeg) / 8;
+    long nb_cpus = sysconf(_SC_NPROCESSORS_ONLN);
+    size_t nb_chunks = (nb_cpus > 1) ? (size_t) nb_cpus : 1;
+    if (nb_chunks > data_size / SPECULATIVE_MIN_CHUNK_SIZE) nb_chunks = data_size / SPECULATIVE_MIN_CHUNK_SIZE;
+
+    return decode_bitstream_speculative_chunks(jpeg, nb_chunks, NULL);
+}
+
+
+int8_t decode_bitstream_speculative_chunks(struct JPEG *jpeg, size_t nb_chunks, bool *sequential_fallback){
+    if (sequential_fallback != NULL) *sequential_fallback = true;
+
+    // Les images avec intervalles de restart sont déjà décodées en parallèle sans spéculation
+    if (get_JPEG_restart_interval(jpeg) != 0) return decode_bitstream(jpeg);
+
+    // Au plus un morceau par octet de données compressées
+    size_t data_size = get_JPEG_image_data_size_in_bits(jpeg) / 8;
+    if (nb_chunks > data_size) nb_chunks = data_size;
+    if (nb_chunks > SPECULATIVE_MAX_NB_OF_CHUNKS) nb_chunks = SPECULATIVE_MAX_NB_OF_CHUNKS;
+    if (nb_chunks < 2) return decode_bitstream(jpeg);
+
+    struct SpeculativeDecoding *decoding = (struct SpeculativeDecoding *) calloc(1, sizeof(struct SpeculativeDecoding));
+    if (check_memory_allocation((void *) decoding)) return setDecoderError(DECODER_ERROR_MEMORY);
+    decoding->jpeg = jpeg;
+    decoding->data = get_JPEG_image_data(jpeg);
+    decoding->data_size = data_size;
+
+    decoding->nb_components = get_sos_nb_components(get_JPEG_sos(jpeg)[0]);
+    for (int8_t i = 0; i < decoding->nb_components; i++) {
+        struct ComponentSOS *component = get_sos_component(get_sos_components(get_JPEG_sos(jpeg)[0]), i);
+        struct ComponentSOF *component_sof = get_sof_component(get_sof_components(get_JPEG_sof(jpeg)[0]), i);
+        decoding->DC_tables[i] = get_JPEG_ht(jpeg, get_DC_huffman_table_id(component));
+        decoding->AC_tables[i] = get_JPEG_ht(jpeg, get_AC_huffman_table_id(component));
+        decoding->nb_blocks[i] = get_sampling_factor_x(component_sof) * get_sampling_factor_y(component_sof);
+    }
+
+    decoding->nb_chunks = nb_chunks;
+    size_t data_bits = 8 * decoding->data_size;
+    // Chaque morceau contient à peu près sa part des MCUs de l'image : on prévoit cette part (+ 1/8 de marge)
+    // pour n'avoir quasiment jamais à agrandir boundaries
+    size_t expected_boundaries = get_nb_MCUs(jpeg) / nb_chunks;
+    expected_boundaries += expected_boundaries / 8 + INITIAL_DATA_SIZE;
+    for (size_t k = 0; k < nb_chunks; k++) {
+        struct SpeculativeChunk *chunk = &decoding->chunks[k];
+        chunk->start_bit = k * data_bits / nb_chunks;
+        chunk->end_bit = (k + 1) * data_bits / nb_chunks;
+        chunk->boundaries_size = expected_boundaries;
+        chunk->boundaries = (size_t *) malloc(chunk->boundaries_size * sizeof(size_t));
+        if (check_memory_allocation((void *) chunk->boundaries)) {
+            free_chunks(decoding);
+            free(decoding);
+            return setDecoderError(DECODER_ERROR_MEMORY);
+        }
+    }
+    getVerbose() ? printf("Décodage spéculatif du bitstream en %ld morceaux\n", nb_chunks):0;
+
+    // (1) et (2) : parcours spéculatif puis resynchronisation de chaque morceau avec les suivants
+    run_in_parallel(decoding, scan_chunk, nb_chunks);
+    run_in_parallel(decoding, synchronize_chunk, nb_chunks - 1);
+    for (size_t k = 0; k + 1 < nb_chunks; k++) {
+        getVerbose() ? printf("\tMorceau %ld : %ld MCUs, resynchronisé après %ld MCUs supplémentaires\n", k, decoding->chunks[k].nb_boundaries, decoding->chunks[k].nb_extra_MCUs):0;
+    }
+
+    // (3) recollage : en cas d'échec, on revient au décodage séquentiel (qui signalera une éventuelle erreur)
+    if (stitch_chunks(decoding)) {
+        getVerbose() ? printf("\tÉchec de la resynchronisation, décodage séquentiel\n"):0;
+        free_chunks(decoding);
+        free(decoding);
+        return decode_bitstream(jpeg);
+    }
+    free_chunks(decoding);
+
+    // (4) décodage exact des segments en parallèle
+    run_in_parallel(decoding, decode_segment, decoding->nb_segments);
+    for (size_t s = 0; s < decoding->nb_segments; s++) {
+        if (decoding->segments[s].status != EXIT_SUCCESS) {
+            free(decoding);
+            resetDecoderStatus();   // l'erreur éventuelle sera de nouveau signalée par le décodage séquentiel
+            return decode_bitstream(jpeg);
+        }
+    }
+
+    // (5) chaque segment hérite des prédicteurs DC de fin du segment précédent : somme préfixe des décalages
+    int16_t DC_offsets[3] = {0};
+    for (size_t s = 0; s < decoding->nb_segments; s++) {
+        for (int8_t i = 0; i < decoding->nb_components; i++) {
+            int16_t last_DC = decoding->segments[s].DC_values[i];
+            decoding->segments[s].DC_values[i] = DC_offsets[i];
+            DC_offsets[i] += last_DC;
+        }
+    }
+    run_in_parallel(decoding, fix_segment_DC, decoding->nb_segments);
+    set_JPEG_dequantized(jpeg, true);
+
+    free(decoding);
+    if (sequential_fallback != NULL) *sequential_fallback = false;
+    return EXIT_SUCCESS;
+}
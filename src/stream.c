@@ -0,0 +1,121 @@
+#define _POSIX_C_SOURCE 200809L
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+#include <stream.h>
+#include <utils.h>
+
+
+// Lecture complète du fichier dans un buffer (quand la projection en mémoire est impossible)
+// expected_size : taille du fichier si elle est connue (fstat), 0 sinon (pipe...)
+// >>> si elle est connue, le buffer est alloué une seule fois (un octet de plus pour constater la fin du fichier)
+static int8_t read_whole_file(struct ByteStream *input, int fd, size_t expected_size){
+    size_t capacity = (expected_size > 0) ? expected_size + 1 : STREAM_READ_BLOCK_SIZE;
+    unsigned char *data = (unsigned char *) malloc(capacity);
+    if (check_memory_allocation((void *) data)) return setDecoderError(DECODER_ERROR_MEMORY);
+
+    size_t size = 0;
+    ssize_t nb_read;
+    while ((nb_read = read(fd, data + size, capacity - size)) > 0) {
+        size += nb_read;
+        if (size == capacity) {
+            capacity *= 2;
+            unsigned char *new_data = (unsigned char *) realloc(data, capacity);
+            if (new_data == NULL) {
+                fprintf(stderr, RED("ERROR : MEMORY - stream.c > read_whole_file()\n"));
+                free(data);
+                return setDecoderError(DECODER_ERROR_MEMORY);
+            }
+            data = new_data;
+        }
+    }
+    if (nb_read < 0) {
+        fprintf(stderr, RED("ERROR : READ - stream.c > read_whole_file()\n"));
+        free(data);
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+
+    input->data = data;
+    input->size = size;
+    input->storage = STREAM_ALLOCATED;
+    return EXIT_SUCCESS;
+}
+
+
+int8_t open_byte_stream(struct ByteStream *input, const char *filename, bool header_only){
+    input->data = NULL;
+    input->size = 0;
+    input->position = 0;
+    input->storage = STREAM_ALLOCATED;
+
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0) {
+        fprintf(stderr, RED("ERROR : OPEN - stream.c > open_byte_stream() with file %s\n"), filename);
+        return setDecoderError(DECODER_ERROR_OPEN);
+    }
+
+    // On projette les fichiers réguliers en mémoire, lus une seule fois du début à la fin
+    // (pour l'en-tête seul, les pages qui suivent ne sont jamais touchées donc jamais lues)
+    struct stat file_stat;
+    bool regular_file = (fstat(fd, &file_stat) == 0 && S_ISREG(file_stat.st_mode) && file_stat.st_size > 0);
+    if (regular_file) {
+        void *mapping = mmap(NULL, file_stat.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (mapping != MAP_FAILED) {
+            if (!header_only) posix_madvise(mapping, file_stat.st_size, POSIX_MADV_SEQUENTIAL);
+            input->data = (const unsigned char *) mapping;
+            input->size = file_stat.st_size;
+            input->storage = STREAM_MAPPED;
+            close(fd);
+            return EXIT_SUCCESS;
+        }
+    }
+
+    int8_t status = read_whole_file(input, fd, regular_file ? (size_t) file_stat.st_size : 0);
+    close(fd);
+    return status;
+}
+
+
+void open_memory_byte_stream(struct ByteStream *input, const unsigned char *data, size_t size){
+    input->data = data;
+    input->size = size;
+    input->position = 0;
+    input->storage = STREAM_BORROWED;
+}
+
+
+void close_byte_stream(struct ByteStream *input){
+    if (input->data != NULL) {
+        if (input->storage == STREAM_MAPPED) {
+            munmap((void *) input->data, input->size);
+        } else if (input->storage == STREAM_ALLOCATED) {
+            free((void *) input->data);
+        }
+    }
+    input->data = NULL;
+    input->size = 0;
+}
+
+
+int8_t read_bytes(struct ByteStream *input, void *destination, size_t nb_bytes){
+    if (nb_bytes > input->size - input->position) {
+        input->position = input->size;
+        return EXIT_FAILURE;
+    }
+    memcpy(destination, input->data + input->position, nb_bytes);
+    input->position += nb_bytes;
+    return EXIT_SUCCESS;
+}
+
+
+int8_t ignore_bytes(struct ByteStream *input, size_t nb_bytes){
+    if (nb_bytes > input->size - input->position) {
+        fprintf(stderr, RED("ERROR : READ - stream.c > ignore_bytes()\n"));
+        input->position = input->size;
+        return setDecoderError(DECODER_ERROR_READ);
+    }
+    input->position += nb_bytes;
+    return EXIT_SUCCESS;
+}
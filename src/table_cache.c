@@ -0,0 +1,99 @@
+#include <table_cache.h>
+
+// Hachage FNV-1a (64 bits) : rapide sur de petites clés (64 à ~200 octets)
+#define FNV_OFFSET_BASIS 0xcbf29ce484222325ULL
+#define FNV_PRIME 0x100000001b3ULL
+
+
+struct TableCacheEntry {
+    uint64_t hash;
+    enum TableCacheKind kind;
+    size_t key_length;
+    unsigned char *key;     // NULL : case libre
+    void *value;
+};
+
+// Table de hachage à adressage ouvert (sondage linéaire) : les entrées ne sont jamais retirées
+static struct TableCacheEntry entries[TABLE_CACHE_SIZE];
+static struct TableCacheStatistics statistics;
+static pthread_mutex_t cache_mutex = PTHREAD_MUTEX_INITIALIZER;
+
+
+static uint64_t hash_key(enum TableCacheKind kind, const unsigned char *key, size_t key_length) {
+    uint64_t hash = FNV_OFFSET_BASIS ^ kind;
+    for (size_t i = 0; i < key_length; i++) {
+        hash ^= key[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+
+// Case de la clé, ou première case libre rencontrée (NULL si le cache est plein sans contenir la clé)
+// À appeler avec cache_mutex verrouillé
+static struct TableCacheEntry * find_entry(uint64_t hash, enum TableCacheKind kind, const unsigned char *key, size_t key_length) {
+    for (size_t probe = 0; probe < TABLE_CACHE_SIZE; probe++) {
+        struct TableCacheEntry *entry = &entries[(hash + probe) % TABLE_CACHE_SIZE];
+        if (entry->key == NULL) return entry;
+        if (entry->hash == hash && entry->kind == kind && entry->key_length == key_length && memcmp(entry->key, key, key_length) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+
+void * table_cache_find(enum TableCacheKind kind, const unsigned char *key, size_t key_length) {
+    uint64_t hash = hash_key(kind, key, key_length);
+
+    pthread_mutex_lock(&cache_mutex);
+    struct TableCacheEntry *entry = find_entry(hash, kind, key, key_length);
+    void *value = (entry != NULL) ? entry->value : NULL;
+    if (kind == TABLE_CACHE_HUFFMAN) {
+        (value != NULL) ? statistics.huffman_hits++ : statistics.huffman_misses++;
+    } else {
+        (value != NULL) ? statistics.quantization_hits++ : statistics.quantization_misses++;
+    }
+    pthread_mutex_unlock(&cache_mutex);
+
+    return value;
+}
+
+
+void * table_cache_insert(enum TableCacheKind kind, const unsigned char *key, size_t key_length, void *value) {
+    uint64_t hash = hash_key(kind, key, key_length);
+
+    pthread_mutex_lock(&cache_mutex);
+    struct TableCacheEntry *entry = find_entry(hash, kind, key, key_length);
+    // Le cache reste au plus aux trois quarts plein (sondages courts)
+    if (entry == NULL || (entry->key == NULL && 4 * (statistics.nb_entries + 1) > 3 * TABLE_CACHE_SIZE)) {
+        pthread_mutex_unlock(&cache_mutex);
+        return NULL;
+    }
+    if (entry->key == NULL) {
+        unsigned char *key_copy = (unsigned char *) malloc(key_length);
+        if (key_copy == NULL) {
+            pthread_mutex_unlock(&cache_mutex);
+            return NULL;
+        }
+        memcpy(key_copy, key, key_length);
+        entry->hash = hash;
+        entry->kind = kind;
+        entry->key_length = key_length;
+        entry->key = key_copy;
+        entry->value = value;
+        statistics.nb_entries++;
+    }
+    value = entry->value;
+    pthread_mutex_unlock(&cache_mutex);
+
+    return value;
+}
+
+
+struct TableCacheStatistics get_table_cache_statistics() {
+    pthread_mutex_lock(&cache_mutex);
+    struct TableCacheStatistics current = statistics;
+    pthread_mutex_unlock(&cache_mutex);
+    return current;
+}
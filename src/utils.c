@@ -1,9 +1,21 @@
 #include <utils.h>
 
+const uint8_t zigzag_table[NB_VALUES_IN_8x8_BLOCK]={
+    0, 1, 8, 16, 9, 2, 3, 10,
+    17, 24, 32, 25, 18, 11, 4, 5,
+    12, 19, 26, 33, 40, 48, 41, 34,
+    27, 20, 13, 6, 7, 14, 21, 28,
+    35, 42, 49, 56, 57, 50, 43, 36,
+    29, 22, 15, 23, 30, 37, 44, 51,
+    58, 59, 52, 45, 38, 31, 39, 46,
+    53, 60, 61, 54, 47, 55, 62, 63
+};
+
+
 int8_t check_memory_allocation(void *allocated_data){
     if(allocated_data == NULL) {
         fprintf(stderr, RED("ERROR : MEMORY - utils.c > check_memory_allocation()\n"));
-        return EXIT_FAILURE;
+        return setDecoderError(DECODER_ERROR_MEMORY);
     }
     return EXIT_SUCCESS;
 }
@@ -1,20 +1,68 @@
 #include "verbose.h"
 
-bool verbose = false;
-bool highly_verbose = false;
+// Contexte par défaut (propre à chaque thread) et contexte associé au thread courant
+static __thread struct DecoderContext default_context = {false, false, DECODER_OK};
+static __thread struct DecoderContext *current_context = NULL;
+
+
+void initializeDecoderContext(struct DecoderContext *context) {
+    context->verbose = false;
+    context->highly_verbose = false;
+    context->status = DECODER_OK;
+}
+
+void bindDecoderContext(struct DecoderContext *context) {
+    current_context = context;
+}
+
+struct DecoderContext * getDecoderContext() {
+    return (current_context != NULL) ? current_context : &default_context;
+}
+
+int8_t setDecoderError(int8_t status) {
+    struct DecoderContext *context = getDecoderContext();
+    int8_t expected = DECODER_OK;
+    // Plusieurs threads d'un même décodeur peuvent échouer en même temps : seule la première erreur est gardée
+    __atomic_compare_exchange_n(&context->status, &expected, status, false, __ATOMIC_RELAXED, __ATOMIC_RELAXED);
+    return __atomic_load_n(&context->status, __ATOMIC_RELAXED);
+}
+
+int8_t getDecoderStatus() {
+    return __atomic_load_n(&getDecoderContext()->status, __ATOMIC_RELAXED);
+}
+
+void resetDecoderStatus() {
+    __atomic_store_n(&getDecoderContext()->status, DECODER_OK, __ATOMIC_RELAXED);
+}
+
+const char * getDecoderStatusName(int8_t status) {
+    switch (status) {
+        case DECODER_OK:                        return "OK";
+        case DECODER_ERROR_GLOBAL:              return "GLOBAL";
+        case DECODER_ERROR_OPEN:                return "OPEN";
+        case DECODER_ERROR_READ:                return "READ";
+        case DECODER_ERROR_FORMAT:              return "FORMAT";
+        case DECODER_ERROR_INCONSISTENT_DATA:   return "INCONSISTENT DATA";
+        case DECODER_ERROR_MEMORY:              return "MEMORY";
+        case DECODER_ERROR_WRITE:               return "WRITE";
+        case DECODER_ERROR_ARGUMENT:            return "ARGUMENT";
+        default:                                return "UNKNOWN";
+    }
+}
+
 
 void setVerbose(bool value) {
-    verbose = value;
+    getDecoderContext()->verbose = value;
 }
 
 bool getVerbose() {
-    return verbose;
+    return getDecoderContext()->verbose;
 }
 
 void setHighlyVerbose(bool value) {
-    highly_verbose = value;
+    getDecoderContext()->highly_verbose = value;
 }
 
 bool getHighlyVerbose() {
-    return highly_verbose;
+    return getDecoderContext()->highly_verbose;
 }
@@ -1,5 +1,6 @@
 #include <stdlib.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <IDCT.h>
 #include <utils.h>
@@ -66,6 +67,54 @@ int main(int argc, char **argv) {
         if(initial_data[i] != expected_data[i]) result = false;
     }
     result ? fprintf(stderr, GREEN("test : OK\n")) : fprintf(stderr, RED("test : KO !!!\n"));
+
+
+    //*************************************************************************************************
+    // test 2 : blocs creux (DC et un seul coefficient AC, d'indice zigzag last_nonzero) de part et d'autre des seuils
+    // de zigzag_last_row et zigzag_last_column où l'IDCT 1D passe de 4 à 8 valeurs (indices 9/10 : dernière ligne 3/4,
+    // indices 13/14 : dernière colonne 3/4), avec chaque noyau disponible, comparés à l'IDCT du bloc complet
+    const struct {
+        uint8_t last_nonzero;
+        int16_t DC;
+        int16_t AC;
+    } sparse_blocks[] = {
+        {0, -1024, 0},          // DC seul (bloc uniforme)
+        {1, 0, 200},            // ligne 0 seulement : toutes les colonnes de la passe 1 sont "DC seul"
+        {9, 40, -300},          // coefficient (3, 0)
+        {10, 40, -300},         // coefficient (4, 0)
+        {13, -8, 250},          // coefficient (1, 3)
+        {14, -8, 250},          // coefficient (0, 4)
+        {35, 0, 500},           // coefficient (7, 0), sans DC
+        {63, 100, -1000},       // coefficient (7, 7)
+        {63, -32768, 32767}     // valeurs extrêmes : saturations de la passe 1 et écrêtage final
+    };
+    const int nb_sparse_blocks = sizeof(sparse_blocks) / sizeof(sparse_blocks[0]);
+    int16_t block[64], expected_block[64];
+
+    result = true;
+    for (int j = 0; j < nb_sparse_blocks; j++) {
+        memset(expected_block, 0, sizeof(expected_block));
+        expected_block[0] = sparse_blocks[j].DC;
+        expected_block[zigzag_table[sparse_blocks[j].last_nonzero]] += sparse_blocks[j].AC;
+        memcpy(block, expected_block, sizeof(block));
+
+        int16_t *expected = expected_block;
+        fast_IDCT_function(&expected);
+
+        for (enum IDCTKernel kernel = IDCT_KERNEL_SCALAR; kernel <= get_IDCT_kernel(); kernel++) {
+            int16_t output[64];
+            memcpy(output, block, sizeof(block));
+            int16_t *input = output;
+            fast_IDCT_function_with_kernel(kernel, &input, sparse_blocks[j].last_nonzero);
+
+            if (memcmp(output, expected_block, sizeof(output)) != 0) {
+                getHighlyVerbose() ? fprintf(stderr, "Noyau %s en erreur (last_nonzero = %u, DC = %d, AC = %d)\n", get_IDCT_kernel_name(kernel),
+                                             sparse_blocks[j].last_nonzero, sparse_blocks[j].DC, sparse_blocks[j].AC):0;
+                result = false;
+            }
+        }
+    }
+    result ? fprintf(stderr, GREEN("test_2 : OK\n")) : fprintf(stderr, RED("test_2 : KO !!!\n"));
     
 
     fprintf(stderr, YELLOW("\n================================================\n"));
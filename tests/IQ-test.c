@@ -1,6 +1,7 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <string.h>
 
 #include <extract.h>
 #include <huffman.h>
@@ -285,6 +286,62 @@ int main(int argc, char **argv) {
     result ? fprintf(stderr, GREEN("\t\ttest_6 : OK\n")) : fprintf(stderr, RED("\t\ttest_6 : KO\n"));
 
 
+    //*************************************************************************************************
+    // test 7 : plan de blocs dont le dernier coefficient non nul tombe de part et d'autre des frontières des vecteurs
+    // SSE2 (8 coefficients : indices 7/8) et AVX2 (16 coefficients : indices 15/16), avec chaque noyau disponible
+    // Le bloc du milieu est vide (nb_nonzero == 0) mais contient encore des valeurs (bloc précédent) : il doit être sauté
+    enum { NB_PLANE_BLOCKS = 5, EMPTY_BLOCK = 2 };
+    const struct {
+        uint8_t last_nonzero;
+        int16_t DC, AC;                     // AC : coefficient d'indice last_nonzero
+        int16_t expected_DC, expected_AC;   // avec test_qt2 (pas de 2 partout)
+    } plane_blocks[NB_PLANE_BLOCKS] = {
+        {7, -20000, 20000, -32768, 32767},  // saturations, jusqu'au dernier coefficient du 1er vecteur SSE2
+        {8, 5, -7, 10, -14},
+        {0, 0, 0, 0, 0},                    // bloc vide
+        {15, 12, 300, 24, 600},
+        {16, -1, -9, -2, -18}
+    };
+    int16_t plane[NB_PLANE_BLOCKS * 64];
+    int16_t expected_plane[NB_PLANE_BLOCKS * 64];
+    struct BlockInfo plane_info[NB_PLANE_BLOCKS];
+
+    memset(expected_plane, 0, sizeof(expected_plane));
+    for (int j = 0; j < NB_PLANE_BLOCKS; j++) {
+        if (j == EMPTY_BLOCK) {
+            plane_info[j] = (struct BlockInfo) {0, 0};
+            for (int i = 0; i < 64; i++) expected_plane[j * 64 + i] = (int16_t) (i - 100);
+            continue;
+        }
+        plane_info[j] = (struct BlockInfo) {2, plane_blocks[j].last_nonzero};
+        expected_plane[j * 64] = plane_blocks[j].expected_DC;
+        expected_plane[j * 64 + plane_blocks[j].last_nonzero] = plane_blocks[j].expected_AC;
+    }
+
+    result = true;
+    for (enum IQKernel kernel = IQ_KERNEL_SCALAR; kernel <= get_IQ_kernel(); kernel++) {
+        memset(plane, 0, sizeof(plane));
+        for (int j = 0; j < NB_PLANE_BLOCKS; j++) {
+            if (j == EMPTY_BLOCK) {
+                memcpy(plane + j * 64, expected_plane + j * 64, 64 * sizeof(int16_t));
+                continue;
+            }
+            plane[j * 64] = plane_blocks[j].DC;
+            plane[j * 64 + plane_blocks[j].last_nonzero] = plane_blocks[j].AC;
+        }
+
+        IQ_plane_with_kernel(kernel, plane, plane_info, NB_PLANE_BLOCKS, test_qt2);
+
+        for (int j = 0; j < NB_PLANE_BLOCKS; j++) {
+            if (memcmp(plane + j * 64, expected_plane + j * 64, 64 * sizeof(int16_t)) != 0) {
+                getHighlyVerbose() ? fprintf(stderr, "Noyau %s en erreur (bloc %d)\n", get_IQ_kernel_name(kernel), j):0;
+                result = false;
+            }
+        }
+    }
+    result ? fprintf(stderr, GREEN("\t\ttest_7 : OK\n")) : fprintf(stderr, RED("\t\ttest_7 : KO\n"));
+
+
     fprintf(stderr, YELLOW("\n================================================\n"));
 
     return EXIT_SUCCESS;
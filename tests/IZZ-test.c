@@ -56,11 +56,7 @@ int main(int argc, char **argv) {
     getHighlyVerbose() ? fprintf(stderr, "Expected output\n"):0;
     print_block((int16_t *)expected_data, 0, 0);
 
-    if (IZZ_function((int16_t **) &initial_data)) {
-        fprintf(stderr, RED("Erreur lors de l'execution de la fonction IZZ\n"));
-        fprintf(stderr, YELLOW("\n================================================\n"));
-        return EXIT_FAILURE;
-    }
+    IZZ_function(initial_data);
 
     getHighlyVerbose() ? fprintf(stderr, "MCU après IZZ\n"):0;
     print_block(initial_data, 0, 0);
@@ -72,6 +68,37 @@ int main(int argc, char **argv) {
     result ? fprintf(stderr, GREEN("test : OK\n")) : fprintf(stderr, RED("test : KO !!!\n"));
 
 
+    //*************************************************************************************************
+    // test 2 : on dé_zig-zag un plan de 3 blocs contigus (complet, creux, réduit au DC) avec chaque noyau disponible
+    int16_t plane[3 * 64];
+    struct BlockInfo blocks_info[3] = {{64, 63}, {5, 4}, {1, 0}};
+
+    result = true;
+    for (enum IZZKernel kernel = IZZ_KERNEL_SCALAR; kernel <= get_IZZ_kernel(); kernel++) {
+        for (int8_t i = 0; i < 64; i++) {
+            plane[i] = zigzag_matrix[i];
+            plane[64 + i] = (i <= 4) ? zigzag_matrix[i] : 0;
+            plane[128 + i] = (i == 0) ? 42 : 0;
+        }
+
+        IZZ_plane_with_kernel(kernel, plane, blocks_info, 3);
+
+        bool kernel_result = true;
+        for(int i = 0; i < 64; i++){
+            if(plane[i] != expected_data[i]) kernel_result = false;
+            // dans le bloc creux, seuls les coefficients 0, 1, 8, 16 et 9 (ordre naturel) sont non nuls
+            int16_t expected_sparse = (i == 0 || i == 1 || i == 8 || i == 9 || i == 16) ? i : 0;
+            if(plane[64 + i] != expected_sparse) kernel_result = false;
+            if(plane[128 + i] != ((i == 0) ? 42 : 0)) kernel_result = false;
+        }
+        if (!kernel_result) {
+            getHighlyVerbose() ? fprintf(stderr, "Noyau %s en erreur\n", get_IZZ_kernel_name(kernel)):0;
+            result = false;
+        }
+    }
+    result ? fprintf(stderr, GREEN("test_2 : OK\n")) : fprintf(stderr, RED("test_2 : KO !!!\n"));
+
+
     fprintf(stderr, YELLOW("\n================================================\n"));
 
 
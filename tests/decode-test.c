@@ -0,0 +1,469 @@
+#include <stdlib.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+#include <decode.h>
+#include <mjpeg.h>
+#include <ppm.h>
+#include <utils.h>
+#include <verbose.h>
+
+
+// Images décodées en mémoire, comparées aux fichiers écrits par jpeg2ppm
+#define COLOR_JPEG "./images/shaun_the_sheep.jpeg"
+#define COLOR_PPM "./images/shaun_the_sheep.ppm"
+#define COLOR_WIDTH 300
+#define COLOR_HEIGHT 225
+
+#define SMALL_JPEG "./images/poupoupidou.jpg"
+#define SMALL_PPM "./images/poupoupidou.ppm"
+
+#define GRAY_JPEG "./images/poupoupidou_bw.jpg"
+#define GRAY_PGM "./images/poupoupidou_bw.pgm"
+
+#define NO_HUFFMAN_TABLES_JPEG "./tests/images-tests/poupoupidou_no_huffman_tables___ERROR_-_INCONSISTENT_DATA_-_huffman.c_build_huffman_tree.jpg"
+#define TWO_TABLES_DQT_MJPEG "./tests/images-tests/poupoupidou_mjpeg_two_tables_in_DQT___NO-ERROR.mjpeg"   // images SMALL_JPEG puis SECOND_FRAME_JPEG
+#define SECOND_FRAME_JPEG "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.jpg"
+#define FOUR_TABLES_DHT_MJPEG "./tests/images-tests/poupoupidou_mjpeg_four_tables_in_DHT___NO-ERROR.mjpeg"     // une image, puis la même avec une seule DHT (deux fois)
+#define NO_CHROMINANCE_QT_JPEG "./tests/images-tests/poupoupidou_no_chrominance_quantization_table___ERROR_-_INCONSISTENT_DATA_-_extract.c_extract_not_fully_initialized.jpg"
+
+
+//**********************************************************************************************************************
+// Lit tout le fichier filename dans un buffer alloué (taille dans *len), NULL en cas d'erreur
+uint8_t * read_file(char *filename, size_t *len) {
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) return NULL;
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    uint8_t *buf = (uint8_t *) malloc((size > 0) ? size : 1);
+    if (buf == NULL || size <= 0 || fread(buf, 1, size, file) != (size_t) size) {
+        free(buf);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    *len = size;
+    return buf;
+}
+
+
+// Lit les pixels d'un fichier PGM (P5) ou PPM (P6) écrit par write_pnm(), NULL en cas d'erreur
+uint8_t * read_pnm(char *filename, size_t *width, size_t *height, uint8_t *nb_components) {
+    FILE *file = fopen(filename, "rb");
+    if (file == NULL) return NULL;
+
+    char magic;
+    unsigned int max_value;
+    if (fscanf(file, "P%c %zu %zu %u", &magic, width, height, &max_value) != 4 || max_value != 255 || fgetc(file) != '\n') {
+        fclose(file);
+        return NULL;
+    }
+    *nb_components = (magic == '5') ? 1 : 3;
+
+    size_t size = *width * *height * *nb_components;
+    uint8_t *pixels = (uint8_t *) malloc((size > 0) ? size : 1);
+    if (pixels == NULL || fread(pixels, 1, size, file) != size) {
+        free(pixels);
+        fclose(file);
+        return NULL;
+    }
+    fclose(file);
+    return pixels;
+}
+
+
+// Lance jpeg2ppm sur filename (le fichier PGM/PPM est écrit à côté), renvoie true si le décodage a réussi
+bool run_jpeg2ppm(char *filename) {
+    pid_t pid = fork();
+
+    if (pid < 0) {
+        perror("fork() failed");
+        return false;
+    } else if (pid == 0) {
+        if (freopen("/dev/null", "w", stdout) == NULL) exit(EXIT_FAILURE);
+        execl("jpeg2ppm", "jpeg2ppm", filename, NULL);
+        perror(RED("\nexecl() failed\n"));
+        exit(EXIT_FAILURE);
+    }
+
+    int status;
+    waitpid(pid, &status, 0);
+    return WIFEXITED(status) && WEXITSTATUS(status) == 0;
+}
+
+
+// Compare height lignes de width * pixel_size octets, espacées de stride octets dans pixels et contiguës dans expected
+bool compare_lines(const uint8_t *pixels, size_t stride, const uint8_t *expected, size_t width, size_t height, uint8_t pixel_size) {
+    size_t line_size = width * pixel_size;
+    for (size_t y = 0; y < height; y++) {
+        if (memcmp(pixels + y * stride, expected + y * line_size, line_size) != 0) {
+            getHighlyVerbose() ? fprintf(stderr, "Ligne %zu différente du fichier écrit par jpeg2ppm\n", y):0;
+            return false;
+        }
+    }
+    return true;
+}
+
+
+// Renvoie la position de la hauteur dans le segment SOF (0 si absent)
+size_t find_SOF_height(const uint8_t *buf, size_t len) {
+    for (size_t i = 0; i + 5 < len; i++) {
+        if (buf[i] == 0xFF && (buf[i + 1] == 0xC0 || buf[i + 1] == 0xC1 || buf[i + 1] == 0xC2)) return i + 5;
+    }
+    return 0;
+}
+
+
+// Décode buf en RGB (cf. decode_JPEG()) avec un décodage de Huffman spéculatif en nb_chunks morceaux
+// *sequential_fallback indique si le décodeur est revenu au décodage séquentiel
+int8_t decode_speculative_chunks(const uint8_t *buf, size_t len, size_t nb_chunks, uint8_t *pixels, bool *sequential_fallback) {
+    struct JPEG *jpeg = extract_mem(buf, len);
+    if (jpeg == NULL) return getDecoderStatus();
+
+    int8_t status = decode_bitstream_speculative_chunks(jpeg, nb_chunks, sequential_fallback);
+    if (status == DECODER_OK) status = IQ(jpeg);
+    if (status == DECODER_OK) status = IZZ(jpeg);
+    if (status == DECODER_OK) status = IDCT(jpeg);
+    if (status == DECODER_OK) {
+        if (get_JPEG_Sampling_Factor_X(jpeg) != 1 || get_JPEG_Sampling_Factor_Y(jpeg) != 1) stretch_function(jpeg);
+        status = YCbCr2RGB(jpeg, false);
+    }
+    if (status == DECODER_OK) write_pixels(jpeg, pixels, get_JPEG_width(jpeg) * 3, PIXEL_FORMAT_RGB24, false);
+
+    free_JPEG_struct(jpeg);
+    return status;
+}
+
+
+int main(int argc, char **argv) {
+
+    // Mode verbose
+    if (argc > 1 && strcmp(argv[1], "-hv") == 0) setHighlyVerbose(true);
+
+    fprintf(stderr, YELLOW("================== TESTS DECODE ==================\n\n"));
+
+    // Fichiers de référence écrits par jpeg2ppm
+    bool references = run_jpeg2ppm(COLOR_JPEG) && run_jpeg2ppm(SMALL_JPEG) && run_jpeg2ppm(GRAY_JPEG);
+
+    size_t color_len = 0, small_len = 0, gray_len = 0;
+    uint8_t *color_jpeg = read_file(COLOR_JPEG, &color_len);
+    uint8_t *small_jpeg = read_file(SMALL_JPEG, &small_len);
+    uint8_t *gray_jpeg = read_file(GRAY_JPEG, &gray_len);
+
+    size_t color_width = 0, color_height = 0, small_width = 0, small_height = 0, gray_width = 0, gray_height = 0;
+    uint8_t color_components = 0, small_components = 0, gray_components = 0;
+    uint8_t *color_ppm = references ? read_pnm(COLOR_PPM, &color_width, &color_height, &color_components) : NULL;
+    uint8_t *small_ppm = references ? read_pnm(SMALL_PPM, &small_width, &small_height, &small_components) : NULL;
+    uint8_t *gray_pgm = references ? read_pnm(GRAY_PGM, &gray_width, &gray_height, &gray_components) : NULL;
+
+    if (color_jpeg == NULL || small_jpeg == NULL || gray_jpeg == NULL || color_ppm == NULL || small_ppm == NULL || gray_pgm == NULL
+        || color_components != 3 || small_components != 3 || gray_components != 1) {
+        fprintf(stderr, RED("ERROR : READ - decode-test.c > main() | cannot read test images (run from the root directory, after make)\n"));
+        return EXIT_FAILURE;
+    }
+
+    uint16_t width, height;
+    int8_t status;
+    bool result;
+
+
+    //*************************************************************************************************
+    // test 1 : pixels == NULL, seules les dimensions sont renvoyées
+
+    width = 0;
+    height = 0;
+    status = jpeg_decode_mem(color_jpeg, color_len, NULL, 0, 0, PIXEL_FORMAT_RGB24, &width, &height);
+
+    getHighlyVerbose() ? fprintf(stderr, "Dimensions : %ux%u (attendues : %ux%u), statut %s\n", width, height, COLOR_WIDTH, COLOR_HEIGHT, getDecoderStatusName(status)):0;
+
+    result = (status == DECODER_OK && width == COLOR_WIDTH && height == COLOR_HEIGHT);
+    result ? fprintf(stderr, GREEN("test 1 : OK\n")) : fprintf(stderr, RED("test 1 : KO\n"));
+
+
+    //*************************************************************************************************
+    // test 2 : décodage RGB complet, identique au fichier PPM écrit par jpeg2ppm
+
+    size_t color_size = color_width * color_height * 3;
+    uint8_t *pixels = (uint8_t *) malloc(color_size);
+    status = jpeg_decode_mem(color_jpeg, color_len, pixels, color_size, color_width * 3, PIXEL_FORMAT_RGB24, &width, &height);
+
+    getHighlyVerbose() ? fprintf(stderr, "Décodage RGB : statut %s\n", getDecoderStatusName(status)):0;
+
+    result = (status == DECODER_OK && width == color_width && height == color_height && memcmp(pixels, color_ppm, color_size) == 0);
+    result ? fprintf(stderr, GREEN("test 2 : OK\n")) : fprintf(stderr, RED("test 2 : KO\n"));
+    free(pixels);
+
+
+    //*************************************************************************************************
+    // test 3 : lignes espacées de stride > largeur, la marge n'est pas modifiée
+
+    size_t stride = color_width * 3 + 7;
+    size_t padded_size = stride * color_height;
+    pixels = (uint8_t *) malloc(padded_size);
+    memset(pixels, 0xAA, padded_size);
+    status = jpeg_decode_mem(color_jpeg, color_len, pixels, padded_size, stride, PIXEL_FORMAT_RGB24, NULL, NULL);
+
+    result = (status == DECODER_OK && compare_lines(pixels, stride, color_ppm, color_width, color_height, 3));
+    for (size_t y = 0; result && y < color_height; y++) {
+        for (size_t x = color_width * 3; x < stride; x++) {
+            if (pixels[y * stride + x] != 0xAA) result = false;
+        }
+    }
+    result ? fprintf(stderr, GREEN("test 3 : OK\n")) : fprintf(stderr, RED("test 3 : KO\n"));
+    free(pixels);
+
+
+    //*************************************************************************************************
+    // test 4 : décodage en niveaux de gris, identique au fichier PGM écrit par jpeg2ppm
+
+    size_t gray_size = gray_width * gray_height;
+    pixels = (uint8_t *) malloc(gray_size);
+    status = jpeg_decode_mem(gray_jpeg, gray_len, pixels, gray_size, gray_width, PIXEL_FORMAT_GRAY8, &width, &height);
+
+    result = (status == DECODER_OK && width == gray_width && height == gray_height && memcmp(pixels, gray_pgm, gray_size) == 0);
+    result ? fprintf(stderr, GREEN("test 4 : OK\n")) : fprintf(stderr, RED("test 4 : KO\n"));
+    free(pixels);
+
+
+    //*************************************************************************************************
+    // test 5 : buffer trop petit (d'un octet, ou stride trop petit), les dimensions sont tout de même renvoyées
+
+    pixels = (uint8_t *) malloc(color_size);
+    width = 0;
+    height = 0;
+    status = jpeg_decode_mem(color_jpeg, color_len, pixels, color_size - 1, color_width * 3, PIXEL_FORMAT_RGB24, &width, &height);
+
+    getHighlyVerbose() ? fprintf(stderr, "Buffer trop petit : statut %s\n", getDecoderStatusName(status)):0;
+
+    result = (status == DECODER_ERROR_ARGUMENT && width == color_width && height == color_height);
+    status = jpeg_decode_mem(color_jpeg, color_len, pixels, color_size, color_width * 3 - 1, PIXEL_FORMAT_RGB24, NULL, NULL);
+    if (status != DECODER_ERROR_ARGUMENT) result = false;
+    result ? fprintf(stderr, GREEN("test 5 : OK\n")) : fprintf(stderr, RED("test 5 : KO\n"));
+    free(pixels);
+
+
+    //*************************************************************************************************
+    // test 6 : image de hauteur nulle, aucun pixel ne doit être écrit (le calcul de la taille ne déborde pas)
+    // Avec stride > largeur, stride * (hauteur - 1) + largeur déborderait sur une taille énorme
+
+    uint8_t *empty_jpeg = (uint8_t *) malloc(small_len);
+    memcpy(empty_jpeg, small_jpeg, small_len);
+    size_t height_position = find_SOF_height(empty_jpeg, small_len);
+    empty_jpeg[height_position] = 0;
+    empty_jpeg[height_position + 1] = 0;
+
+    uint8_t canary = 0xAA;
+    width = 0;
+    height = 1;
+    status = jpeg_decode_mem(empty_jpeg, small_len, &canary, 0, small_width * 3 + 8, PIXEL_FORMAT_RGB24, &width, &height);
+
+    getHighlyVerbose() ? fprintf(stderr, "Hauteur nulle : %ux%u, statut %s\n", width, height, getDecoderStatusName(status)):0;
+
+    result = (height_position != 0 && status != DECODER_ERROR_ARGUMENT && width == small_width && height == 0 && canary == 0xAA);
+    result ? fprintf(stderr, GREEN("test 6 : OK\n")) : fprintf(stderr, RED("test 6 : KO\n"));
+    free(empty_jpeg);
+
+
+    //*************************************************************************************************
+    // test 7 : décodeur réutilisable, images de tailles différentes à la suite puis à nouveau la première
+
+    struct JPEGDecoder *decoder = create_JPEG_decoder();
+    const uint8_t *decoder_pixels = NULL;
+
+    status = JPEG_decoder_decode_mem(decoder, color_jpeg, color_len, PIXEL_FORMAT_RGB24, &decoder_pixels, &width, &height);
+    result = (status == DECODER_OK && width == color_width && height == color_height && memcmp(decoder_pixels, color_ppm, color_size) == 0);
+
+    status = JPEG_decoder_decode_mem(decoder, small_jpeg, small_len, PIXEL_FORMAT_RGB24, &decoder_pixels, &width, &height);
+    if (status != DECODER_OK || width != small_width || height != small_height
+        || memcmp(decoder_pixels, small_ppm, small_width * small_height * 3) != 0) result = false;
+
+    status = JPEG_decoder_decode_mem(decoder, color_jpeg, color_len, PIXEL_FORMAT_RGB24, &decoder_pixels, &width, &height);
+    if (status != DECODER_OK || memcmp(decoder_pixels, color_ppm, color_size) != 0) result = false;
+
+    result ? fprintf(stderr, GREEN("test 7 : OK\n")) : fprintf(stderr, RED("test 7 : KO\n"));
+
+
+    //*************************************************************************************************
+    // test 8 : décodeur réutilisable, une image tronquée échoue sans empêcher de décoder la suivante
+
+    status = JPEG_decoder_decode_mem(decoder, color_jpeg, color_len / 2, PIXEL_FORMAT_RGB24, &decoder_pixels, NULL, NULL);
+
+    getHighlyVerbose() ? fprintf(stderr, "Image tronquée : statut %s\n", getDecoderStatusName(status)):0;
+
+    result = (status != DECODER_OK);
+    status = JPEG_decoder_decode_mem(decoder, gray_jpeg, gray_len, PIXEL_FORMAT_GRAY8, &decoder_pixels, &width, &height);
+    if (status != DECODER_OK || width != gray_width || height != gray_height || memcmp(decoder_pixels, gray_pgm, gray_size) != 0) result = false;
+
+    reset_JPEG_decoder(decoder);
+    status = JPEG_decoder_decode_mem(decoder, small_jpeg, small_len, PIXEL_FORMAT_RGB24, &decoder_pixels, NULL, NULL);
+    if (status != DECODER_OK || memcmp(decoder_pixels, small_ppm, small_width * small_height * 3) != 0) result = false;
+
+    result ? fprintf(stderr, GREEN("test 8 : OK\n")) : fprintf(stderr, RED("test 8 : KO\n"));
+    free_JPEG_decoder(decoder);
+
+
+    //*************************************************************************************************
+    // test 9 : image sans DHT, l'erreur est détectée dès la lecture de l'en-tête (pixels == NULL : rien n'est décodé)
+
+    size_t no_tables_len = 0;
+    uint8_t *no_tables_jpeg = read_file(NO_HUFFMAN_TABLES_JPEG, &no_tables_len);
+    status = (no_tables_jpeg != NULL) ? jpeg_decode_mem(no_tables_jpeg, no_tables_len, NULL, 0, 0, PIXEL_FORMAT_RGB24, NULL, NULL) : DECODER_OK;
+
+    getHighlyVerbose() ? fprintf(stderr, "Image sans DHT : statut %s\n", getDecoderStatusName(status)):0;
+
+    result = (status == DECODER_ERROR_INCONSISTENT_DATA);
+    result ? fprintf(stderr, GREEN("test 9 : OK\n")) : fprintf(stderr, RED("test 9 : KO\n"));
+    free(no_tables_jpeg);
+
+
+    //*************************************************************************************************
+    // test 10 : table de quantification des chrominances jamais définie, l'image n'est pas décodée (composantes uniformes)
+
+    size_t no_qt_len = 0;
+    uint8_t *no_qt_jpeg = read_file(NO_CHROMINANCE_QT_JPEG, &no_qt_len);
+    pixels = (uint8_t *) malloc(small_width * small_height * 3);
+    status = (no_qt_jpeg != NULL) ? jpeg_decode_mem(no_qt_jpeg, no_qt_len, pixels, small_width * small_height * 3, small_width * 3, PIXEL_FORMAT_RGB24, NULL, NULL) : DECODER_OK;
+
+    getHighlyVerbose() ? fprintf(stderr, "Image sans table de quantification des chrominances : statut %s\n", getDecoderStatusName(status)):0;
+
+    result = (status == DECODER_ERROR_INCONSISTENT_DATA);
+    result ? fprintf(stderr, GREEN("test 10 : OK\n")) : fprintf(stderr, RED("test 10 : KO\n"));
+    free(no_qt_jpeg);
+    free(pixels);
+
+
+    //*************************************************************************************************
+    // test 11 : flux Motion-JPEG dont chaque DQT contient les deux tables (la 2e image dans l'ordre chrominance, luminance)
+    // Chaque image doit être identique au décodage de l'image d'origine (une DQT par table)
+
+    size_t frame_size = small_width * small_height * 3;
+    uint8_t *expected_frames = (uint8_t *) malloc(2 * frame_size);
+    uint8_t *frames = (uint8_t *) malloc(2 * frame_size + 1);
+    size_t second_len = 0;
+    uint8_t *second_jpeg = read_file(SECOND_FRAME_JPEG, &second_len);
+
+    result = (second_jpeg != NULL
+              && jpeg_decode_mem(small_jpeg, small_len, expected_frames, frame_size, small_width * 3, PIXEL_FORMAT_RGB24, NULL, NULL) == DECODER_OK
+              && jpeg_decode_mem(second_jpeg, second_len, expected_frames + frame_size, frame_size, small_width * 3, PIXEL_FORMAT_RGB24, NULL, NULL) == DECODER_OK);
+
+    FILE *stream_output = tmpfile();
+    status = (stream_output != NULL) ? decode_mjpeg(TWO_TABLES_DQT_MJPEG, stream_output, FRAME_OUTPUT_RAW, false, false) : DECODER_ERROR_WRITE;
+
+    getHighlyVerbose() ? fprintf(stderr, "Flux Motion-JPEG : statut %s\n", getDecoderStatusName(status)):0;
+
+    if (status != DECODER_OK) result = false;
+    if (result) {
+        rewind(stream_output);
+        size_t nb_read = fread(frames, 1, 2 * frame_size + 1, stream_output);
+        if (nb_read != 2 * frame_size || memcmp(frames, expected_frames, 2 * frame_size) != 0) result = false;
+    }
+    if (stream_output != NULL) fclose(stream_output);
+
+    result ? fprintf(stderr, GREEN("test 11 : OK\n")) : fprintf(stderr, RED("test 11 : KO\n"));
+    free(second_jpeg);
+    free(frames);
+    free(expected_frames);
+
+
+    //*************************************************************************************************
+    // test 12 : flux Motion-JPEG (tables de Huffman optimisées, pas les tables standard) : la 1re image a une DHT par
+    // table, les deux suivantes une seule DHT avec les quatre tables (dans l'ordre, puis à l'envers)
+    // Les trois images doivent être identiques au décodage de la 1re image seule
+
+    size_t four_tables_len = 0;
+    uint8_t *four_tables_mjpeg = read_file(FOUR_TABLES_DHT_MJPEG, &four_tables_len);
+    size_t first_frame_len = 0;
+    for (size_t i = 0; four_tables_mjpeg != NULL && i + 1 < four_tables_len && first_frame_len == 0; i++) {
+        if (four_tables_mjpeg[i] == 0xFF && four_tables_mjpeg[i + 1] == 0xD9) first_frame_len = i + 2;
+    }
+
+    uint16_t frame_width = 0, frame_height = 0;
+    status = (first_frame_len != 0) ? jpeg_decode_mem(four_tables_mjpeg, first_frame_len, NULL, 0, 0, PIXEL_FORMAT_RGB24, &frame_width, &frame_height) : DECODER_ERROR_READ;
+    frame_size = (size_t) frame_width * frame_height * 3;
+    expected_frames = (uint8_t *) malloc(frame_size + 1);
+    frames = (uint8_t *) malloc(3 * frame_size + 1);
+
+    result = (status == DECODER_OK && frame_size != 0
+              && jpeg_decode_mem(four_tables_mjpeg, first_frame_len, expected_frames, frame_size, frame_width * 3, PIXEL_FORMAT_RGB24, NULL, NULL) == DECODER_OK);
+
+    stream_output = tmpfile();
+    status = (stream_output != NULL) ? decode_mjpeg(FOUR_TABLES_DHT_MJPEG, stream_output, FRAME_OUTPUT_RAW, false, false) : DECODER_ERROR_WRITE;
+
+    getHighlyVerbose() ? fprintf(stderr, "Flux Motion-JPEG (DHT à quatre tables) : statut %s\n", getDecoderStatusName(status)):0;
+
+    if (status != DECODER_OK) result = false;
+    if (result) {
+        rewind(stream_output);
+        size_t nb_read = fread(frames, 1, 3 * frame_size + 1, stream_output);
+        if (nb_read != 3 * frame_size) result = false;
+        for (size_t i = 0; result && i < 3; i++) {
+            if (memcmp(frames + i * frame_size, expected_frames, frame_size) != 0) {
+                getHighlyVerbose() ? fprintf(stderr, "Image %zu différente de la 1re image décodée seule\n", i + 1):0;
+                result = false;
+            }
+        }
+    }
+    if (stream_output != NULL) fclose(stream_output);
+
+    result ? fprintf(stderr, GREEN("test 12 : OK\n")) : fprintf(stderr, RED("test 12 : KO\n"));
+    free(four_tables_mjpeg);
+    free(frames);
+    free(expected_frames);
+
+
+    //*************************************************************************************************
+    // test 13 : décodage de Huffman spéculatif en 2, 4, 16 et 64 morceaux (chacun se resynchronise avec le suivant),
+    // identique au décodage séquentiel
+
+    const size_t speculative_nb_chunks[] = {2, 4, 16, 64};
+    size_t speculative_size = (size_t) COLOR_WIDTH * COLOR_HEIGHT * 3;
+    uint8_t *sequential_pixels = (uint8_t *) malloc(speculative_size);
+    uint8_t *speculative_pixels = (uint8_t *) malloc(speculative_size);
+    bool sequential_fallback;
+
+    result = (jpeg_decode_mem(color_jpeg, color_len, sequential_pixels, speculative_size, COLOR_WIDTH * 3, PIXEL_FORMAT_RGB24, NULL, NULL) == DECODER_OK);
+    for (size_t i = 0; result && i < sizeof(speculative_nb_chunks) / sizeof(speculative_nb_chunks[0]); i++) {
+        memset(speculative_pixels, 0, speculative_size);
+        sequential_fallback = true;
+        status = decode_speculative_chunks(color_jpeg, color_len, speculative_nb_chunks[i], speculative_pixels, &sequential_fallback);
+
+        getHighlyVerbose() ? fprintf(stderr, "%zu morceaux : statut %s, %s\n", speculative_nb_chunks[i], getDecoderStatusName(status), sequential_fallback ? "décodage séquentiel" : "décodage spéculatif"):0;
+
+        if (status != DECODER_OK || sequential_fallback || memcmp(speculative_pixels, sequential_pixels, speculative_size) != 0) result = false;
+    }
+    result ? fprintf(stderr, GREEN("test 13 : OK\n")) : fprintf(stderr, RED("test 13 : KO\n"));
+
+
+    //*************************************************************************************************
+    // test 14 : en 33 morceaux, un morceau de COLOR_JPEG ne retrouve aucune frontière de MCU du suivant : le décodeur
+    // revient au décodage séquentiel, toujours identique
+
+    memset(speculative_pixels, 0, speculative_size);
+    sequential_fallback = false;
+    status = decode_speculative_chunks(color_jpeg, color_len, 33, speculative_pixels, &sequential_fallback);
+
+    getHighlyVerbose() ? fprintf(stderr, "33 morceaux : statut %s, %s\n", getDecoderStatusName(status), sequential_fallback ? "décodage séquentiel" : "décodage spéculatif"):0;
+
+    result = (status == DECODER_OK && sequential_fallback && memcmp(speculative_pixels, sequential_pixels, speculative_size) == 0);
+    result ? fprintf(stderr, GREEN("test 14 : OK\n")) : fprintf(stderr, RED("test 14 : KO\n"));
+    free(sequential_pixels);
+    free(speculative_pixels);
+
+
+    free(color_jpeg);
+    free(small_jpeg);
+    free(gray_jpeg);
+    free(color_ppm);
+    free(small_ppm);
+    free(gray_pgm);
+
+    fprintf(stderr, "\n");
+    return EXIT_SUCCESS;
+}
@@ -1,6 +1,8 @@
 #include <stdlib.h>
 #include <stdint.h>
+#include <stdbool.h>
 #include <stdio.h>
+#include <string.h>
 #include <unistd.h>
 #include <sys/wait.h>
 #include <signal.h>
@@ -53,7 +55,12 @@ int main() {
         "./tests/images-tests/poupoupidou_invalid_sampling_factor___ERROR_-_INCONSISTENT_DATA_-_extract.c_get_SOF_sampling_factor.jpg",
         "./tests/images-tests/poupoupidou_invalid_huffman_table_invalid_level_number2___ERROR_-_INCONSISTENT_DATA_-_extract.c_get_DHT_huffman_table_build_huffman_tree.jpg",
         "./tests/images-tests/poupoupidou_invalid_huffman_table_invalid_not_enough_symbols___ERROR_-_INCONSISTENT_DATA_-_extract.c_get_DHT_huffman_table_build_huffman_tree.jpg",
-        "./tests/images-tests/poupoupidou_no_huffman_tables___ERROR_-_INCONSISTENT_DATA_-_huffman.c_build_huffman_tree.jpg"
+        "./tests/images-tests/poupoupidou_no_huffman_tables___ERROR_-_INCONSISTENT_DATA_-_huffman.c_build_huffman_tree.jpg",
+        "./tests/images-tests/poupoupidou_no_chrominance_quantization_table___ERROR_-_INCONSISTENT_DATA_-_extract.c_extract_not_fully_initialized.jpg",
+        "./tests/images-tests/poupoupidou_restart_intervals___NO-ERROR.jpg",   // génère bien le fichier
+        "./tests/images-tests/poupoupidou_progressive___NO-ERROR.jpg",  // SOF2 : scans DC/AC, EOBRUN, raffinements
+        "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.jpg",  // mêmes coefficients, en mode séquentiel
+        "./tests/images-tests/poupoupidou_exif_with_MPF_image_in_APP2___NO-ERROR.jpg"   // Exif, puis une image 40x30 dans APP2 et APP13 : sautées
     };
 
     int num_of_tests = sizeof(test_files) / sizeof(test_files[0]); // Calculate the number of files
@@ -97,5 +104,74 @@ int main() {
         }        
     }
 
+    //**************************************************************************************************************************
+    // Tests avec une option de jpeg2ppm : le décodage doit réussir (code de retour nul)
+
+    char* option_tests[][2] = {   // option, fichier
+        {"--mjpeg", "./tests/images-tests/poupoupidou_mjpeg_second_frame_without_DHT___NO-ERROR.mjpeg"},  // 1re image : tables optimisées, 2e sans DHT : tables standard
+        {"--mjpeg", "./tests/images-tests/poupoupidou_mjpeg_two_tables_in_DQT___NO-ERROR.mjpeg"},  // tables de quantification dans une même DQT
+        {"--mjpeg", "./tests/images-tests/poupoupidou_mjpeg_four_tables_in_DHT___NO-ERROR.mjpeg"},  // tables de Huffman dans une même DHT
+        {"--preview", "./tests/images-tests/poupoupidou_progressive___NO-ERROR.jpg"},  // aperçu calculé à partir des coefficients DC
+        {"--thumbnail", "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.jpg"}    // sans vignette Exif : image à 1/8 (DC seuls)
+    };
+
+    int num_of_option_tests = sizeof(option_tests) / sizeof(option_tests[0]);
+
+    for (int i = 0; i < num_of_option_tests; i++) {
+        pid_t pid = fork();
+
+        if (pid < 0) {
+            perror("fork() failed");
+            exit(EXIT_FAILURE);
+        } else if (pid == 0) {
+            // Child process : les images brutes écrites sur la sortie standard (--mjpeg) ne sont pas affichées
+            if (freopen("/dev/null", "w", stdout) == NULL) exit(EXIT_FAILURE);
+            execl("jpeg2ppm", "jpeg2ppm", option_tests[i][0], option_tests[i][1], NULL);
+            perror(RED("\nexecl() failed\n"));
+            exit(EXIT_FAILURE);
+        } else {
+            // Parent process
+            int status;
+            waitpid(pid, &status, 0);
+
+            if (WIFEXITED(status) && WEXITSTATUS(status) == EXIT_SUCCESS) {
+                fprintf(stderr, GREEN("Test %d OK\n\n"), num_of_tests + i + 1);
+            } else {
+                fprintf(stderr, RED("Test %d KO\n\n"), num_of_tests + i + 1);
+            }
+        }
+    }
+
+    //**************************************************************************************************************************
+    // Fichiers générés par les tests précédents qui doivent être identiques
+    // >>> image progressive : même résultat que la même image encodée en mode séquentiel
+    // >>> aperçu (--preview) : même résultat que la même image décodée avec --thumbnail sans vignette Exif (1/8, DC seuls)
+    // >>> segments APPn contenant une autre image JPEG : même résultat que l'image seule
+
+    char* same_output_files[][2] = {
+        {"./tests/images-tests/poupoupidou_progressive___NO-ERROR.ppm", "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.ppm"},
+        {"./tests/images-tests/poupoupidou_progressive___NO-ERROR.preview.ppm", "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.thumbnail.ppm"},
+        {"./tests/images-tests/poupoupidou_exif_with_MPF_image_in_APP2___NO-ERROR.ppm", "./tests/images-tests/poupoupidou_progressive_baseline_version___NO-ERROR.ppm"}
+    };
+
+    int num_of_same_output_tests = sizeof(same_output_files) / sizeof(same_output_files[0]);
+
+    for (int i = 0; i < num_of_same_output_tests; i++) {
+        int test_number = num_of_tests + num_of_option_tests + i + 1;
+        FILE *files[2] = {fopen(same_output_files[i][0], "rb"), fopen(same_output_files[i][1], "rb")};
+        bool same = (files[0] != NULL && files[1] != NULL);
+        while (same) {
+            unsigned char buffers[2][4096];
+            size_t sizes[2] = {fread(buffers[0], 1, sizeof(buffers[0]), files[0]), fread(buffers[1], 1, sizeof(buffers[1]), files[1])};
+            if (sizes[0] != sizes[1] || memcmp(buffers[0], buffers[1], sizes[0]) != 0) same = false;
+            if (sizes[0] < sizeof(buffers[0])) break;
+        }
+        for (int j = 0; j < 2; j++) {
+            if (files[j] != NULL) fclose(files[j]);
+        }
+
+        same ? fprintf(stderr, GREEN("Test %d OK\n\n"), test_number) : fprintf(stderr, RED("Test %d KO\n\n"), test_number);
+    }
+
     return EXIT_SUCCESS;
 }
@@ -0,0 +1,82 @@
+// Génère (sur la sortie standard) l'en-tête standard_huffman_tables.h : tables de décodage des tables de Huffman
+// standard (annexe K), calculées par les fonctions du décodeur (cf. huffman_tables.c) une fois pour toutes à la compilation
+// Chaque table est décrite par des macros d'initialisation, utilisées par extract.c pour des tables "static const" :
+// >>> STANDARD_HUFFMAN_CANONICAL_<i> : struct HuffmanCanonical
+// >>> STANDARD_HUFFMAN_LOOKUP_<i>    : struct HuffmanLookup
+// >>> STANDARD_AC_FAST_LOOKUP_<i>    : struct ACFastLookup (vide pour les tables DC)
+// i : indice de la table dans standard_huffman_tables (DC luminance, DC chrominance, AC luminance, AC chrominance)
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include <huffman_tables.h>
+#include <standard_tables.h>
+
+// Nombre de valeurs par ligne dans les tableaux générés
+#define VALUES_PER_LINE 16
+
+
+static void print_int32_array(const int32_t *values, size_t nb_values) {
+    printf("{");
+    for (size_t i = 0; i < nb_values; i++) {
+        printf("%s%d", (i == 0) ? "" : ",", values[i]);
+    }
+    printf("}");
+}
+
+static void print_uint8_array(const uint8_t *values, size_t nb_values) {
+    printf("{");
+    for (size_t i = 0; i < nb_values; i++) {
+        printf("%s%s%u", (i == 0) ? "" : ",", (i % VALUES_PER_LINE == 0) ? " \\\n        " : "", values[i]);
+    }
+    printf("}");
+}
+
+
+int main(void) {
+    printf("// Fichier généré par tools/generate_standard_tables.c : ne pas modifier\n");
+    printf("#ifndef _STANDARD_HUFFMAN_TABLES_H_\n#define _STANDARD_HUFFMAN_TABLES_H_\n");
+
+    for (int8_t i = 0; i < NB_OF_STANDARD_HUFFMAN_TABLES; i++) {
+        const struct StandardHuffmanTable *standard_table = &standard_huffman_tables[i];
+
+        static struct HuffmanCanonical canonical;
+        static struct HuffmanLookup lookup;
+        static struct ACFastLookup AC_fast;
+        memset(&canonical, 0, sizeof(struct HuffmanCanonical));
+        if (build_huffman_table((unsigned char *) standard_table->data, standard_table->length, &canonical, &lookup)) {
+            fprintf(stderr, "generate_standard_tables : table %d invalide\n", i);
+            return EXIT_FAILURE;
+        }
+        if (standard_table->class == 1) {
+            build_AC_fast_lookup((unsigned char *) standard_table->data, &AC_fast);
+        } else {
+            memset(&AC_fast, 0, sizeof(struct ACFastLookup));
+        }
+
+        printf("\n#define STANDARD_HUFFMAN_CANONICAL_%d { \\\n    ", i);
+        print_int32_array(canonical.maxcode, MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK + 1);
+        printf(", \\\n    ");
+        print_int32_array(canonical.valoffset, MAX_HUFFMAN_CODE_LENGTH_FOR_8x8_BLOCK + 1);
+        printf(", \\\n    ");
+        print_uint8_array(canonical.huffval, MAX_HUFFMAN_SYMBOLS);
+        printf("}\n");
+
+        printf("\n#define STANDARD_HUFFMAN_LOOKUP_%d { \\\n    ", i);
+        print_uint8_array(lookup.length, HUFFMAN_LOOKAHEAD_SIZE);
+        printf(", \\\n    ");
+        print_uint8_array(lookup.symbol, HUFFMAN_LOOKAHEAD_SIZE);
+        printf("}\n");
+
+        printf("\n#define STANDARD_AC_FAST_LOOKUP_%d {{", i);
+        for (size_t e = 0; e < AC_FAST_SIZE; e++) {
+            const struct ACFastEntry *entry = &AC_fast.entries[e];
+            printf("%s%s{%d,%u,%u}", (e == 0) ? "" : ",", (e % VALUES_PER_LINE == 0) ? " \\\n    " : "", entry->value, entry->run, entry->length);
+        }
+        printf("}}\n");
+    }
+
+    printf("\n#endif\n");
+    return EXIT_SUCCESS;
+}